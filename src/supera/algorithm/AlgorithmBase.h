@@ -3,6 +3,8 @@
 
 #include "supera/base/Loggable.h"
 #include "supera/base/Configurable.h"
+#include "supera/base/RunStats.h"
+#include "supera/base/Tracer.h"
 
 namespace supera {
 
@@ -14,7 +16,7 @@ namespace supera {
   , public Configurable {
 
   public:
-    AlgorithmBase(std::string name="no_name") : Loggable(name) {}
+    AlgorithmBase(std::string name="no_name") : Loggable(name), _stats(nullptr), _tracer(nullptr) {}
 
     virtual ~AlgorithmBase() {}
 
@@ -27,9 +29,18 @@ namespace supera {
       this->_configure(cfg);
     }
 
+    /// Run-wide metrics that every processed event is recorded into (nullptr to disable)
+    void SetStats(RunStats* stats) { _stats = stats; }
+
+    /// Tracer that stage spans are recorded into (nullptr to disable)
+    void SetTracer(Tracer* tracer) { _tracer = tracer; }
+
   protected:
 
     virtual void _configure(const YAML::Node& cfg) = 0;
+
+    RunStats* _stats; ///< not owned, may be nullptr
+    Tracer* _tracer;  ///< not owned, may be nullptr
     
   };
 
@@ -2,6 +2,7 @@
 #define __LARTPCMLRECO3D_CXX__
 
 #include "LArTPCMLReco3D.h"
+#include "MergeWorklist.h"
 #include <algorithm>
 #include <cassert>
 #include <set>
@@ -9,12 +10,43 @@
 #include <sstream>
 #include <cmath>
 #include <cfloat>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
 
 namespace supera {
 
+    namespace {
+        /// Bit pattern of a vertex's (x,y,z,t): equal keys <=> equal vertices (as long as no coordinate is NaN)
+        struct VertexKey {
+            std::uint64_t bits[4];
+            bool operator==(const VertexKey& rhs) const { return std::memcmp(bits, rhs.bits, sizeof(bits)) == 0; }
+        };
+
+        struct VertexKeyHash {
+            size_t operator()(const VertexKey& key) const
+            {
+                std::uint64_t result = 0;
+                for(auto const& word : key.bits)
+                    result = (result ^ word) * 0x9E3779B97F4A7C15ull;
+                return (size_t)(result ^ (result >> 32));
+            }
+        };
+
+        VertexKey MakeVertexKey(const supera::Vertex& vtx)
+        {
+            VertexKey key;
+            // + 0. folds -0 into +0, which compare equal
+            const double values[4] = {vtx.pos.x + 0., vtx.pos.y + 0., vtx.pos.z + 0., vtx.time + 0.};
+            std::memcpy(key.bits, values, sizeof(key.bits));
+            return key;
+        }
+    }
+
     LArTPCMLReco3D::LArTPCMLReco3D(std::string name)
     : LabelAlgorithm(name)
     // , _debug(0)
+    , _pool(new WorkStealingPool(1))
     {}
 
     // --------------------------------------------------------------------
@@ -53,6 +85,17 @@ namespace supera {
         if(cfg["RewriteInteractionID"])
             _rewrite_interactionid = cfg["RewriteInteractionID"].as<bool>();
 
+        _interaction_vtx_precision = -1;
+        if(cfg["InteractionVertexPrecision"])
+            _interaction_vtx_precision = cfg["InteractionVertexPrecision"].as<int>();
+
+        // threads for the per-particle stages of a single event (0: all hardware threads).
+        // Within Driver::GenerateBatch only one event at a time gets them, the others run these stages serially.
+        size_t num_threads = 1;
+        if(cfg["NumThreads"])
+            num_threads = cfg["NumThreads"].as<size_t>();
+        _pool.reset(new WorkStealingPool(num_threads));
+
         std::vector<double> min_coords(3,std::numeric_limits<double>::lowest());
         std::vector<double> max_coords(3,std::numeric_limits<double>::max());
         if(cfg["WorldBoundMin"])
@@ -64,6 +107,25 @@ namespace supera {
             max_coords.at(0),max_coords.at(1),max_coords.at(2));
 
     }
+    // --------------------------------------------------------------------
+    void LArTPCMLReco3D::ParallelFor(size_t num_items, size_t work,
+                                     const std::function<void(size_t,size_t)>& fn) const
+    {
+        // below this (in EDeps/voxels/labels) spawning threads costs more than it saves
+        const size_t kMinParallelWork = 1 << 15;
+        // verbose messages go to one stream: keep them in order
+        if(_pool->num_threads() < 2 || num_items < 2 || work < kMinParallelWork || LOG.verbose()) {
+            for(size_t index = 0; index < num_items; ++index) fn(index, 0);
+            return;
+        }
+        // a few blocks per thread, so that stealing evens out the large particles
+        size_t num_tasks = std::min(num_items, 16 * _pool->num_threads());
+        _pool->run(num_tasks, [num_items, num_tasks, &fn](size_t task, size_t thread) {
+            for(size_t index = num_items * task / num_tasks; index < num_items * (task + 1) / num_tasks; ++index)
+                fn(index, thread);
+        });
+    }
+
     // --------------------------------------------------------------------
 
     void LArTPCMLReco3D::SetSemanticPriority(std::vector<size_t>& order)
@@ -101,81 +163,142 @@ namespace supera {
         order = result;
     }
 
-    EventOutput LArTPCMLReco3D::Generate(const EventInput& data, const ImageMeta3D& meta)
+    EventOutput LArTPCMLReco3D::Generate(const EventInput& data, const ImageMeta3D& meta) const
+    {
+        Workspace ws;
+        return this->Generate(data, meta, ws);
+    }
+
+    EventOutput LArTPCMLReco3D::Generate(const EventInput& data, const ImageMeta3D& meta, Workspace& ws) const
     {
         LOG_DEBUG() << "starting" << std::endl;
 
         EventOutput result;
+        ws.stats.clear();
 
         // fill in the working structures that link the list of particles and its genealogy
-        _mcpl.InferParentage(data);
-        std::vector<supera::Index_t> const& trackid2index = _mcpl.TrackIdToIndex();
+        {
+            StageTimer timer(ws.stats, kStageInferParentage, _tracer);
+            ws.mcpl.InferParentage(data);
+        }
 
         // Assign the initial labels for each particle.
         // They will be grouped together in various ways in the subsequent steps.
-        std::vector<supera::ParticleLabel> labels = this->InitializeLabels(data, meta);
+        std::vector<supera::ParticleLabel> labels;
+        {
+            StageTimer timer(ws.stats, kStageInitializeLabels, _tracer);
+            labels = this->InitializeLabels(ws, data, meta);
+        }
+        ws.forest.Reset(labels.size());
+        ws.stats.peak(kPeakLabels, labels.size());
 
         // Now group the labels together in certain cases
         // (e.g.: electromagnetic showers, neutron clusters, ...)
         // There are lots of edge cases so the logic is spread out over many methods.
-        //this->MergeShowerIonizations(labels); // merge supera::kIonization = too small delta rays into parents
+        //this->MergeShowerIonizations(ws, labels); // merge supera::kIonization = too small delta rays into parents
         // ** TODO identify and merge too-small shower fragments to other touching showers **
-        this->MergeShowerTouchingElectron(meta, labels); // merge larcv::kShapeLEScatter to touching shower
+        {
+            StageTimer timer(ws.stats, kStageMergeShowerTouchingElectron, _tracer);
+            this->MergeShowerTouchingElectron(ws, meta, labels); // merge larcv::kShapeLEScatter to touching shower
+        }
         // Apply energy threshold (may drop some pixels)
-        this->ApplyEnergyThreshold(labels);
-        this->SetSemanticType(labels);
-        
-        this->MergeShowerConversion(labels); // merge supera::kConversion a photon merged to a parent photon
-        this->MergeShowerFamilyTouching(meta, labels); // merge supera::kShapeShower to touching parent shower/delta/michel
-        this->MergeShowerTouching(meta, labels); // merge supera::kShapeShower to touching shower in the same family tree
-        this->MergeShowerTouchingLEScatter(meta,labels);
-        
+        {
+            StageTimer timer(ws.stats, kStageApplyEnergyThreshold, _tracer);
+            this->ApplyEnergyThreshold(ws, labels);
+        }
+        {
+            StageTimer timer(ws.stats, kStageSetSemanticType, _tracer);
+            this->SetSemanticType(labels);
+        }
+
+        {
+            StageTimer timer(ws.stats, kStageMergeShowerConversion, _tracer);
+            this->MergeShowerConversion(ws, labels); // merge supera::kConversion a photon merged to a parent photon
+        }
+        {
+            StageTimer timer(ws.stats, kStageMergeShowerFamilyTouching, _tracer);
+            this->MergeShowerFamilyTouching(ws, meta, labels); // merge supera::kShapeShower to touching parent shower/delta/michel
+        }
+        {
+            StageTimer timer(ws.stats, kStageMergeShowerTouching, _tracer);
+            this->MergeShowerTouching(ws, meta, labels); // merge supera::kShapeShower to touching shower in the same family tree
+        }
+        {
+            StageTimer timer(ws.stats, kStageMergeShowerTouchingLEScatter, _tracer);
+            this->MergeShowerTouchingLEScatter(ws, meta,labels);
+        }
+
         // ** TODO consider this separate from MergeShowerIonizations?? **
-        this->MergeDeltas(labels); // merge supera::kDelta to a parent if too small
+        {
+            StageTimer timer(ws.stats, kStageMergeDeltas, _tracer);
+            this->MergeDeltas(ws, labels); // merge supera::kDelta to a parent if too small
+        }
 
-        // Re-classify small photons into ShapeLEScatter
-        for(auto& label : labels) {
-            if(!label.valid) continue;
-            if(label.part.type != supera::kPhoton) continue;
-            if(label.energy.size() < _compton_size)
-                label.part.shape = supera::kShapeLEScatter;
+        {
+            StageTimer timer(ws.stats, kStageFillMergedTrackIDs, _tracer);
+            // Re-classify small photons into ShapeLEScatter
+            for(auto& label : labels) {
+                if(!label.valid) continue;
+                if(label.part.type != supera::kPhoton) continue;
+                if(label.energy.size() < _compton_size)
+                    label.part.shape = supera::kShapeLEScatter;
+            }
+
+            // Record which particles ended up in each group
+            this->FillMergedTrackIDs(ws, labels);
         }
 
         // Now that we have grouped the true particles together,
         // at this point we're ready to build a new set of labels
         // which contain only the top particle of each merged group.
         // The first step will be to create a mapping
-        // from the original GEANT4 trackids to the new groups.
-        std::vector<supera::Index_t> trackid2output(trackid2index.size(), kINVALID_INDEX);  // index: original GEANT4 trackid.  stored value: output group index.
-        std::vector<supera::TrackID_t> output2trackid;  // reverse of above.
-        output2trackid.reserve(trackid2index.size());
-        
-        this->RegisterOutputParticles(trackid2index, labels, output2trackid, trackid2output);
+        // from the original GEANT4 particles to the new groups.
+        std::vector<supera::Index_t> input2output(labels.size(), kINVALID_INDEX);  // index: input index of the original GEANT4 track.  stored value: output group index.
+        std::vector<supera::TrackID_t> output2trackid;  // output group index => GEANT4 trackid of the group.
+        output2trackid.reserve(labels.size());
 
-        this->SetGroupID(labels);
+        {
+            StageTimer timer(ws.stats, kStageRegisterOutputParticles, _tracer);
+            this->RegisterOutputParticles(ws, labels, output2trackid, input2output);
+        }
 
-        this->SetAncestorAttributes(labels);
+        {
+            StageTimer timer(ws.stats, kStageSetGroupID, _tracer);
+            this->SetGroupID(ws, labels);
+        }
+
+        {
+            StageTimer timer(ws.stats, kStageSetAncestorAttributes, _tracer);
+            this->SetAncestorAttributes(ws, labels);
+        }
 
         // maybe the user has already set these upstream
         // (like in DUNE ND-LAr case)
-        if (_rewrite_interactionid)
-          this->SetInteractionID(labels);
+        if (_rewrite_interactionid) {
+            StageTimer timer(ws.stats, kStageSetInteractionID, _tracer);
+            this->SetInteractionID(labels);
+        }
 
         // Convert unassociated energy depositions into voxel set 
         supera::VoxelSet unass;
-        size_t invalid_unass_ctr=0;
-        unass.reserve(data.unassociated_edeps.size());
-        for(auto const& edep : data.unassociated_edeps){
-            auto vox_id = meta.id(edep);
-            if(vox_id == supera::kINVALID_VOXELID) {
-                invalid_unass_ctr++;
-                continue;
+        {
+            StageTimer timer(ws.stats, kStageUnassociatedEDeps, _tracer);
+            size_t invalid_unass_ctr=0;
+            unass.reserve(data.unassociated_edeps.size());
+            for(auto const& edep : data.unassociated_edeps){
+                auto vox_id = meta.id(edep);
+                if(vox_id == supera::kINVALID_VOXELID) {
+                    invalid_unass_ctr++;
+                    continue;
+                }
+                unass.stage(vox_id, edep.e);
             }
-            unass.emplace(vox_id, edep.e, true);
-        }
-        if(invalid_unass_ctr){
-            LOG_WARNING() << invalid_unass_ctr << "/" << data.unassociated_edeps.size()
-            << " unassociated packets are ignored (outside BBox)" << std::endl;
+            unass.finalize(true);
+            if(invalid_unass_ctr){
+                LOG_WARNING() << invalid_unass_ctr << "/" << data.unassociated_edeps.size()
+                << " unassociated packets are ignored (outside BBox)" << std::endl;
+            }
+            ws.stats.count(kCounterUnassociatedOutsideBBox, invalid_unass_ctr);
         }
 
         // We're finally to fill in the output container.
@@ -186,14 +309,22 @@ namespace supera {
         // each of which has voxels attached to it, so that covers both things.
         // EventOutput computes VoxelSets with the sum across all particles
         // for voxel energies and semantic labels
-        this->BuildOutputLabels(labels,result,output2trackid,unass);
+        {
+            StageTimer timer(ws.stats, kStageBuildOutputLabels, _tracer);
+            this->BuildOutputLabels(ws, labels,result,output2trackid,unass);
+        }
+        ws.stats.peak(kPeakOutputParticles, result.Particles().size());
+        ws.stats.peak(kPeakVoxels, result._energies.size());
+        ws.stats.count(kCounterEvents);
+
+        if(_stats) _stats->record(ws.stats);
 
         return result;
     }
 
     // --------------------------------------------------------------------
 
-    void LArTPCMLReco3D::BuildOutputLabels(std::vector<supera::ParticleLabel>& labels,
+    void LArTPCMLReco3D::BuildOutputLabels(const Workspace& ws, std::vector<supera::ParticleLabel>& labels,
         supera::EventOutput& result, 
         const std::vector<TrackID_t>& output2trackid,
         const supera::VoxelSet& unass) const
@@ -203,7 +334,7 @@ namespace supera {
         std::vector<supera::ParticleLabel> output_particles;
         output_particles.reserve(output2trackid.size());
         for(auto const& trackid : output2trackid) {
-            auto index = this->InputIndex(trackid);
+            auto index = ws.InputIndex(trackid);
             output_particles.emplace_back(std::move(labels[index]));
             labels[index].valid=false;
         }
@@ -211,9 +342,9 @@ namespace supera {
         // Fill the energy and semantic label tensor for unassociated 3D points
         result._energies.reserve(unass.size());
         result._semanticLabels.reserve(unass.size());
-        for(auto const& vox : unass.as_vector()) {
-            result._energies.emplace(vox.id(),vox.value(),true);
-            result._semanticLabels.emplace(vox.id(),supera::kShapeLEScatter,false);
+        for(size_t i=0; i<unass.size(); ++i) {
+            result._energies.stage(unass.ids()[i],unass.values()[i]);
+            result._semanticLabels.stage(unass.ids()[i],supera::kShapeLEScatter);
         }
 
         // Semantic label
@@ -229,13 +360,13 @@ namespace supera {
                 //result._dEdXs.reserve(label.energy.size()+result._dEdXs.size());
                 result._energies.reserve(label.energy.size()+result._energies.size());
                 result._semanticLabels.reserve(label.energy.size()+result._semanticLabels.size());
-                auto const& input_dedx   = label.dedx.as_vector();
-                auto const& input_energy = label.energy.as_vector();
-                for(size_t i=0; i<input_dedx.size(); ++i) {
+                auto const& input_ids    = label.energy.ids();
+                auto const& input_energy = label.energy.values();
+                for(size_t i=0; i<label.dedx.size(); ++i) {
                     //result._dEdXs.emplace(input_dedx[i].id(),input_dedx[i].value(),true);
-                    result._energies.emplace(input_energy[i].id(),input_energy[i].value(),true);
-                    result._semanticLabels.emplace(input_energy[i].id(),(float)(stype),false);
-                    if(std::isnan(input_energy[i].value())) {
+                    result._energies.stage(input_ids[i],input_energy[i]);
+                    result._semanticLabels.stage(input_ids[i],(float)(stype));
+                    if(std::isnan(input_energy[i])) {
                         LOG_ERROR() << "NAN found (HE)" << std::endl;
                         LOG_ERROR() << label.dump() << std::endl;
                         throw meatloaf();
@@ -259,13 +390,13 @@ namespace supera {
                     //result._dEdXs.reserve(label.energy.size()+result._dEdXs.size());
                     result._energies.reserve(label.energy.size()+result._energies.size());
                     result._semanticLabels.reserve(label.energy.size()+result._semanticLabels.size());
-                    auto const& input_dedx   = label.dedx.as_vector();
-                    auto const& input_energy = label.energy.as_vector();
-                    for(size_t i=0; i<input_dedx.size(); ++i) {
+                    auto const& input_ids    = label.energy.ids();
+                    auto const& input_energy = label.energy.values();
+                    for(size_t i=0; i<label.dedx.size(); ++i) {
                         //result._dEdXs.emplace(input_dedx[i].id(),input_dedx[i].value(),true);
-                        result._energies.emplace(input_energy[i].id(),input_energy[i].value(),true);
-                        result._semanticLabels.emplace(input_energy[i].id(),(float)(stype),false);
-                        if(std::isnan(input_energy[i].value())) {
+                        result._energies.stage(input_ids[i],input_energy[i]);
+                        result._semanticLabels.stage(input_ids[i],(float)(stype));
+                        if(std::isnan(input_energy[i])) {
                             LOG_ERROR() << "NAN found (LE)" << std::endl;
                             LOG_ERROR() << label.dump() << std::endl;
                             throw meatloaf();
@@ -275,6 +406,10 @@ namespace supera {
             }
         }
 
+        // Energies are summed, and the semantic type staged last (= highest priority) wins
+        result._energies.finalize(true);
+        result._semanticLabels.finalize(false);
+
         result = std::move(output_particles);
         result._unassociated_voxels = unass;
     }
@@ -282,21 +417,35 @@ namespace supera {
     // --------------------------------------------------------------------
 
     // ------------------------------------------------------
-    void LArTPCMLReco3D::MergeParticleLabel(std::vector<supera::ParticleLabel>& labels,
+    void LArTPCMLReco3D::MergeParticleLabel(Workspace& ws, std::vector<supera::ParticleLabel>& labels,
         TrackID_t dest_trackid,
         TrackID_t target_trackid) const 
     {
-        auto& dest   = labels.at(this->InputIndex(dest_trackid));
-        auto& target = labels.at(this->InputIndex(target_trackid));
+        auto& dest   = labels.at(ws.InputIndex(dest_trackid));
+        auto& target = labels.at(ws.InputIndex(target_trackid));
         dest.Merge(target);
-        for(auto const& trackid : target.merged_v)
-            labels.at(this->InputIndex(trackid)).merge_id = dest.part.trackid;
+        ws.forest.Merge(ws.InputIndex(dest_trackid), ws.InputIndex(target_trackid));
+        ws.stats.merge();
+    }
+    // ------------------------------------------------------
+
+    void LArTPCMLReco3D::FillMergedTrackIDs(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
+    {
+        for(size_t index = 0; index < labels.size(); ++index) {
+            auto& label = labels[index];
+            label.merged_v.clear();
+            if(!label.valid) continue;
+            for(auto const& member : ws.forest.Members(index)) {
+                label.merged_v.push_back(labels[member].part.trackid);
+                labels[member].merge_id = label.part.trackid;
+            }
+        }
     }
     // ------------------------------------------------------
 
 
     // ------------------------------------------------------
-    void LArTPCMLReco3D::SetGroupID(std::vector<supera::ParticleLabel>& labels) const
+    void LArTPCMLReco3D::SetGroupID(const Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         for(auto& label : labels){
@@ -309,7 +458,7 @@ namespace supera {
                 part.group_id = part.id;
             }else{
 
-                auto parent_index = this->InputIndex(part.parent_trackid);
+                auto parent_index = ws.InputIndex(part.parent_trackid);
 
                 switch(part.shape)
                 {
@@ -328,9 +477,9 @@ namespace supera {
 
                     case kShapeShower:
                         part.group_id = part.id;
-                        for(auto const& parent_trackid : _mcpl.ParentTrackIdArray(label.part.trackid))
+                        for(auto const& parent_trackid : ws.mcpl.ParentTrackIdArray(label.part.trackid))
                         {
-                            parent_index = this->InputIndex(parent_trackid);
+                            parent_index = ws.InputIndex(parent_trackid);
                             if(parent_index == kINVALID_INDEX)
                                 continue;
                             if(!labels[parent_index].valid)
@@ -359,7 +508,7 @@ namespace supera {
 
     // ------------------------------------------------------
 
-    void LArTPCMLReco3D::SetAncestorAttributes(std::vector<supera::ParticleLabel>& labels) const
+    void LArTPCMLReco3D::SetAncestorAttributes(const Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         for(auto& label : labels){
@@ -367,7 +516,7 @@ namespace supera {
             if(!label.valid) continue;
             auto parent_trackid   = label.part.parent_trackid;
             auto ancestor_trackid = label.part.ancestor_trackid;
-            auto const& parent_trackid_v = _mcpl.ParentTrackIdArray(label.part.trackid);
+            auto const& parent_trackid_v = ws.mcpl.ParentTrackIdArray(label.part.trackid);
 
             // Consistency check
             if(parent_trackid == kINVALID_TRACKID && parent_trackid_v.size())
@@ -405,7 +554,7 @@ namespace supera {
             }
 
             // Attempt to fill parent info. 
-            auto parent_index = this->InputIndex(parent_trackid);
+            auto parent_index = ws.InputIndex(parent_trackid);
             if(parent_index != kINVALID_INDEX) {
                 auto const& parent = labels[parent_index];
                 label.part.parent_trackid = parent.part.trackid;
@@ -416,7 +565,7 @@ namespace supera {
             }
 
             // Attempt to fill ancestor info
-            auto ancestor_index = this->InputIndex(ancestor_trackid);
+            auto ancestor_index = ws.InputIndex(ancestor_trackid);
             if(ancestor_index != kINVALID_INDEX) {
                 auto const& ancestor = labels[ancestor_index];
                 label.part.ancestor_trackid = ancestor.part.trackid;
@@ -435,65 +584,79 @@ namespace supera {
     void LArTPCMLReco3D::SetInteractionID(std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
-        std::vector<supera::Vertex> int2vtx;
+        // interaction ID = order of first appearance of the ancestor vertex
+        std::unordered_map<VertexKey, InstanceID_t, VertexKeyHash> vtx2int;
+        InstanceID_t num_interactions = 0;
         for(auto& label : labels) {
             if(!label.valid) continue;
 
-            InstanceID_t iid = kINVALID_INSTANCEID;
-            for(InstanceID_t cand_iid=0; cand_iid<int2vtx.size(); ++cand_iid)
-            {
-                auto const& vtx = int2vtx[cand_iid];
-                if(vtx == label.part.ancestor_vtx){
-                    iid = cand_iid;
-                    break;
-                }
-            }
-            if(iid == kINVALID_INSTANCEID){
-                iid = int2vtx.size();
-                int2vtx.push_back(label.part.ancestor_vtx);
+            // unset vertices (kINVALID_DOUBLE) are always matched exactly
+            auto vtx = label.part.ancestor_vtx;
+            if(_interaction_vtx_precision >= 0 && vtx.time != kINVALID_DOUBLE &&
+               vtx.pos.x != kINVALID_DOUBLE && vtx.pos.y != kINVALID_DOUBLE && vtx.pos.z != kINVALID_DOUBLE)
+                vtx.approx(_interaction_vtx_precision);
+
+            // NaN never equals anything: such a vertex is always a new interaction
+            if(std::isnan(vtx.pos.x) || std::isnan(vtx.pos.y) || std::isnan(vtx.pos.z) || std::isnan(vtx.time)) {
+                label.part.interaction_id = num_interactions++;
+                continue;
             }
-            label.part.interaction_id = iid;
+            auto inserted = vtx2int.emplace(MakeVertexKey(vtx), num_interactions);
+            if(inserted.second) ++num_interactions;
+            label.part.interaction_id = inserted.first->second;
         }
     }
     // ------------------------------------------------------
 
 
     // ------------------------------------------------------
-    void LArTPCMLReco3D::ApplyEnergyThreshold(std::vector<supera::ParticleLabel>& labels) const
+    void LArTPCMLReco3D::ApplyEnergyThreshold(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
-        // Loop again and eliminate voxels that has energy below threshold
-        for (auto &label : labels)
+        // Loop again and eliminate voxels that has energy below threshold (labels are independent: in parallel)
+        size_t num_voxels = 0;
+        for (auto const& label : labels) num_voxels += label.energy.size();
+        std::vector<uint64_t> dropped_v(_pool->num_threads(), 0);
+
+        this->ParallelFor(labels.size(), num_voxels, [&](size_t label_index, size_t thread)
         {
+            auto &label = labels[label_index];
             supera::VoxelSet energies, dEdXs;
             energies.reserve (label.energy.size() );
             dEdXs.reserve    (label.dedx.size()   );
 
-            const auto energy_vec =  label.energy.as_vector();
-            const auto dedx_vec   =  label.dedx.as_vector();
+            auto const& energy_ids = label.energy.ids();
+            auto const& energy_vec = label.energy.values();
+            auto const& dedx_ids   = label.dedx.ids();
+            auto const& dedx_vec   = label.dedx.values();
             for (std::size_t idx = 0; idx < energy_vec.size(); idx++)
             {
-                const auto & vox = energy_vec[idx];
-                if (vox.value() < _edep_threshold)
+                if (energy_vec[idx] < _edep_threshold)
                     continue;
-                if (dedx_vec[idx].id() != vox.id()) {
+                if (dedx_ids[idx] != energy_ids[idx]) {
                     LOG_FATAL() << "Unmatched voxel ID between dE/dX and energy voxels \n";
                     throw meatloaf(std::to_string(__LINE__));
                 }
-                energies.emplace (vox.id(), vox.value(),           true);
-                dEdXs.emplace    (vox.id(), dedx_vec[idx].value(), true);
+                energies.emplace (energy_ids[idx], energy_vec[idx], true);
+                dEdXs.emplace    (energy_ids[idx], dedx_vec[idx],   true);
             }
+            dropped_v[thread] += label.energy.size() - energies.size();
             label.energy = std::move(energies);
             label.dedx = std::move(dEdXs);
-        }
+        });
+
+        for (auto const& num_dropped : dropped_v)
+            ws.stats.count(kCounterThresholdVoxels, num_dropped);
     } // LArTPCMLReco3D::ApplyEnergyThreshold()
 
     // ------------------------------------------------------
     void LArTPCMLReco3D::SetSemanticType(std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
-        for(auto& label : labels) {
-            if(!label.valid) continue;
+        this->ParallelFor(labels.size(), labels.size(), [&](size_t label_index, size_t)
+        {
+            auto& label = labels[label_index];
+            if(!label.valid) return;
 
             switch(label.part.type) {
                 case kInvalidProcess:
@@ -569,16 +732,16 @@ namespace supera {
                         label.part.shape = kShapeLEScatter;
                     break;
             }
-        }
+        });
     }
 
 
     // ------------------------------------------------------
     
-    void LArTPCMLReco3D::RegisterOutputParticles(const std::vector<TrackID_t> &trackid2index,
+    void LArTPCMLReco3D::RegisterOutputParticles(const Workspace& ws,
         std::vector<supera::ParticleLabel> &inputLabels,
         std::vector<TrackID_t> &output2trackid,
-        std::vector<Index_t> &trackid2output) const
+        std::vector<Index_t> &input2output) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         /*
@@ -594,11 +757,21 @@ namespace supera {
         */
 
         std::vector<Index_t> lescatter_index_v;
-        lescatter_index_v.reserve(trackid2index.size());    
+        lescatter_index_v.reserve(inputLabels.size());    
     
         // first create the track id list
         output2trackid.clear();
-        output2trackid.reserve(trackid2index.size());
+        output2trackid.reserve(inputLabels.size());
+
+        // sum up the deposited energy of every particle first (independent: in parallel)
+        size_t num_voxels = 0;
+        for (auto const& label : inputLabels) num_voxels += label.energy.size();
+        std::vector<double> energy_deposit_v(inputLabels.size(), 0.);
+        this->ParallelFor(inputLabels.size(), num_voxels, [&](size_t label_index, size_t)
+        {
+            auto const& energy = inputLabels[label_index].energy;
+            energy_deposit_v[label_index] = energy.size() ? energy.sum() : 0.;
+        });
 
         // assign particle group ID numbers and make sure they have all info set
         LOG_VERBOSE() << "Considering incoming particles:\n";
@@ -609,7 +782,7 @@ namespace supera {
             LOG_VERBOSE() << "     PDG=" << inputLabel.part.pdg << "\n";
             LOG_VERBOSE() << "     Edep=" << inputLabel.part.energy_deposit << "\n";
 
-            inputLabel.part.energy_deposit = inputLabel.energy.size() ? inputLabel.energy.sum() : 0.;
+            inputLabel.part.energy_deposit = energy_deposit_v[label_index];
 
             if (!inputLabel.valid)
             {
@@ -645,9 +818,9 @@ namespace supera {
             LOG_VERBOSE() << "   --> Assigned output id = " << part.id << "\n";
 
             // 2. Set merged particle track ID to also point to the output ID of its superset particle
-            trackid2output[part.trackid] = part.id;
+            input2output[label_index] = part.id;
             for (auto const &child : inputLabel.merged_v)
-                trackid2output[child] = part.id;
+                input2output[ws.InputIndex(child)] = part.id;
 
             // 3. Record track ID => Output index mapping            
             output2trackid.push_back(inputLabel.part.trackid);
@@ -674,9 +847,9 @@ namespace supera {
                 LOG_VERBOSE() << "   --> Assigned output id = " << part.id << "\n";
 
                 // 2. Set merged particle track ID to also point to the output ID of its superset particle
-                trackid2output[part.trackid] = part.id;
+                input2output[label_index] = part.id;
                 for (auto const &child : inputLabel.merged_v)
-                    trackid2output[child] = part.id;
+                    input2output[ws.InputIndex(child)] = part.id;
 
                 // 3. Record track ID => Output index mapping            
                 output2trackid.push_back(inputLabel.part.trackid);
@@ -698,14 +871,14 @@ namespace supera {
         {
             auto& part = inputLabel.part;
             part.parent_id = kINVALID_INSTANCEID;
-            auto parent_index = this->InputIndex(part.parent_trackid);
+            auto parent_index = ws.InputIndex(part.parent_trackid);
             if(parent_index == kINVALID_INDEX) continue;
             part.parent_id = inputLabels[parent_index].part.id;
         }
 
-        LOG_VERBOSE() << "trackid2output (i.e., map of track IDs to output IDs) contents:\n";
-        for (std::size_t idx = 0; idx < trackid2output.size(); idx++)
-            LOG_VERBOSE() << "   " << idx << " -> " << trackid2output[idx] << "\n";
+        LOG_VERBOSE() << "input2output (i.e., map of track IDs to output IDs) contents:\n";
+        for (std::size_t idx = 0; idx < input2output.size(); idx++)
+            LOG_VERBOSE() << "   " << inputLabels[idx].part.trackid << " -> " << input2output[idx] << "\n";
 
     } // LArTPCMLReco3D::RegisterOutputParticles()
 
@@ -759,9 +932,9 @@ namespace supera {
             auto const vtx = grp.part.vtx.pos;
             double min_dist = fabs(kINVALID_DOUBLE);
             Point3D min_pt;
-            for (auto const &vox : grp.energy.as_vector())
+            for (auto const &vox_id : grp.energy.ids())
             {
-                auto const pt = meta.position(vox.id());
+                auto const pt = meta.position(vox_id);
                 double dist = pt.squared_distance(vtx);
                 if (dist > min_dist)
                     continue;
@@ -778,22 +951,28 @@ namespace supera {
     */
 
     std::vector<supera::ParticleLabel>
-    LArTPCMLReco3D::InitializeLabels(const EventInput &evtInput, const supera::ImageMeta3D &meta) const
+    LArTPCMLReco3D::InitializeLabels(Workspace& ws, const EventInput &evtInput, const supera::ImageMeta3D &meta) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         // this default-constructs the whole lot of them, which fills their values with defaults/invalid values
         std::vector<supera::ParticleLabel> labels(evtInput.size());
 
         LOG_DEBUG() << "Initializing labels with incoming particles...\n";
-        for (std::size_t idx = 0; idx < evtInput.size(); idx++)
+        // particles are independent: voxelize them in parallel, counting per thread
+        size_t num_edeps = 0;
+        for (auto const& input : evtInput) num_edeps += input.pcloud.size();
+        std::vector<uint64_t> outside_v(_pool->num_threads(), 0);
+
+        this->ParallelFor(evtInput.size(), num_edeps, [&](size_t idx, size_t thread)
         {
             auto& label = labels[idx];
             label.part  = evtInput[idx].part;
-            label.part.parent_pdg = _mcpl.ParentPdgCode()[idx];
+            label.part.parent_pdg = ws.mcpl.ParentPdgCode()[idx];
 
             if(label.part.parent_pdg != supera::kINVALID_PDG)
                 label.valid = true;
 
+            uint64_t num_outside = 0;
             for (const supera::EDep & edep : evtInput[idx].pcloud)
             {
                 auto vox_id = meta.id(edep);
@@ -801,18 +980,27 @@ namespace supera {
                     LOG_VERBOSE() << "Skipping EDep from track ID " << label.part.trackid
                     << " E=" << edep.e
                     << " pos=" << edep.x << "," << edep.y << "," << edep.z << ")\n";
+                    ++num_outside;
                     continue;
                 }
 
-                label.energy.emplace (vox_id, edep.e,    true);
-                label.dedx.emplace   (vox_id, edep.dedx, true);
+                label.energy.stage (vox_id, edep.e   );
+                label.dedx.stage   (vox_id, edep.dedx);
                 label.UpdateFirstPoint(edep);
                 label.UpdateLastPoint(edep);
             }
+            outside_v[thread] += num_outside;
+            // EDeps are not voxel-ordered (e.g. showers): sort & sum once per particle
+            label.energy.finalize(true);
+            label.dedx.finalize(true);
+            label.bounds = meta.bounds(label.energy);
 
             LOG_VERBOSE() << label.dump() << "\n";
 
-        }  // for (idx)
+        });  // for (idx)
+
+        for (auto const& num_outside : outside_v)
+            ws.stats.count(kCounterEDepOutsideBBox, num_outside);
 
         return labels;
     }  // LArTPCMLReco3D::InitializeLabels()
@@ -820,56 +1008,54 @@ namespace supera {
 
     // ------------------------------------------------------
 
-    void LArTPCMLReco3D::MergeShowerConversion(std::vector<supera::ParticleLabel>& labels) const
+    void LArTPCMLReco3D::MergeShowerConversion(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
+        // Merging only invalidates labels, so a conversion electron that finds no valid parent
+        // can never find one later: a single pass already reaches the fixed point.
         int merge_ctr = 0;
         //int invalid_ctr = 0;
-        do
+        for (auto &label : labels)
         {
-            merge_ctr = 0;
-            for (auto &label : labels)
-            {
-                if (!label.valid) continue;
-                //if(grp.part.type != supera::kIonization && grp.part.type != supera::kConversion) continue;
-                if (label.part.type != supera::kConversion) continue;
-                if (std::abs(label.part.pdg) != 11) {
-                    LOG_FATAL() << "Unexpected: type kConversion for a particle that is not electron!\n";
-                    throw meatloaf(std::to_string(__LINE__));
-                }
+            if (!label.valid) continue;
+            //if(grp.part.type != supera::kIonization && grp.part.type != supera::kConversion) continue;
+            if (label.part.type != supera::kConversion) continue;
+            if (std::abs(label.part.pdg) != 11) {
+                LOG_FATAL() << "Unexpected: type kConversion for a particle that is not electron!\n";
+                throw meatloaf(std::to_string(__LINE__));
+            }
 
-                auto const& parent_trackid_v = _mcpl.ParentTrackIdArray(label.part.trackid);
-                TrackID_t found_trackid = kINVALID_TRACKID;
-                for(auto const& parent_trackid : parent_trackid_v) 
+            auto const& parent_trackid_v = ws.mcpl.ParentTrackIdArray(label.part.trackid);
+            TrackID_t found_trackid = kINVALID_TRACKID;
+            for(auto const& parent_trackid : parent_trackid_v) 
+            {
+                LOG_DEBUG() << "Inspecting: trackid " << StringifyTrackID(label.part.trackid)
+                << " => parent trackid " << StringifyTrackID(parent_trackid) << "\n";
+                auto const& parent_index = ws.InputIndex(parent_trackid);
+                if (parent_index == supera::kINVALID_INDEX || !labels[parent_index].valid)
                 {
-                    LOG_DEBUG() << "Inspecting: trackid " << StringifyTrackID(label.part.trackid)
-                    << " => parent trackid " << StringifyTrackID(parent_trackid) << "\n";
-                    auto const& parent_index = this->InputIndex(parent_trackid);
-                    if (parent_index == supera::kINVALID_INDEX || !labels[parent_index].valid)
-                    {
-                        LOG_VERBOSE() << "Missing/Invalid parent particle with a track id " << StringifyTrackID(parent_trackid) << "\n"
-                                      << "Could not find a parent for trackid " << StringifyTrackID(label.part.trackid) 
-                                      << " PDG " << label.part.pdg
-                                      << " " << label.part.process << " E = " << label.part.energy_init
-                                      << " (" << label.part.energy_deposit << ") MeV\n";
-                        continue;
-                    }
-                    found_trackid = parent_trackid;
-                    break;
-                }
-                if (found_trackid != kINVALID_TRACKID) {
-                    this->MergeParticleLabel(labels,found_trackid,label.part.trackid);
-                    merge_ctr++;
+                    LOG_VERBOSE() << "Missing/Invalid parent particle with a track id " << StringifyTrackID(parent_trackid) << "\n"
+                                  << "Could not find a parent for trackid " << StringifyTrackID(label.part.trackid) 
+                                  << " PDG " << label.part.pdg
+                                  << " " << label.part.process << " E = " << label.part.energy_init
+                                  << " (" << label.part.energy_deposit << ") MeV\n";
+                    continue;
                 }
+                found_trackid = parent_trackid;
+                break;
             }
+            if (found_trackid != kINVALID_TRACKID) {
+                this->MergeParticleLabel(ws, labels,found_trackid,label.part.trackid);
+                merge_ctr++;
+            }
+        }
 
-            LOG_INFO() << "Merge counter: " << merge_ctr << "\n";
-        } while (merge_ctr > 0);
+        LOG_DEBUG() << "Merge counter: " << merge_ctr << "\n";
     }  // LArTPCMLReco3D::MergeShowerConversion()
 
     // ------------------------------------------------------
     
-    void LArTPCMLReco3D::MergeDeltas(std::vector<supera::ParticleLabel>& labels) const
+    void LArTPCMLReco3D::MergeDeltas(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         for (auto &label : labels)
@@ -877,7 +1063,7 @@ namespace supera {
             //if(label.part.type != supera::kDelta) continue;
             if (label.part.shape != supera::kShapeDelta) continue;
             auto parent_trackid = label.part.parent_trackid;
-            auto parent_index   = this->InputIndex(parent_trackid);
+            auto parent_index   = ws.InputIndex(parent_trackid);
             if(parent_index == kINVALID_INDEX) continue;
             auto &parent = labels[parent_index];
             if (!parent.valid) continue;
@@ -887,9 +1073,9 @@ namespace supera {
             const auto UniqueVoxelCount = [](const supera::ParticleLabel & grp, const supera::ParticleLabel & parent)
             {
                 size_t unique_voxel_count = 0;
-                for (auto const &vox : grp.energy.as_vector())
+                for (auto const &vox_id : grp.energy.ids())
                 {
-                    if (parent.energy.find(vox.id()).id() == supera::kINVALID_VOXELID)
+                    if (parent.energy.index(vox_id) == supera::kINVALID_SIZE)
                         ++unique_voxel_count;
                 }
                 return unique_voxel_count;
@@ -905,7 +1091,7 @@ namespace supera {
                             << " ... parent found " << parent.part.trackid
                             << " PDG " << parent.part.pdg << " " << parent.part.process << "\n";
                 LOG_INFO() << "Time difference: " << label.part.first_step.time - parent.part.first_step.time << "\n";
-                this->MergeParticleLabel(labels, parent.part.trackid, label.part.trackid);
+                this->MergeParticleLabel(ws, labels, parent.part.trackid, label.part.trackid);
             }
             else
             {
@@ -919,7 +1105,7 @@ namespace supera {
     } // LArTPCMLReco3D::MergeShowerDeltas()
     // ------------------------------------------------------
 
-    void LArTPCMLReco3D::MergeShowerFamilyTouching(const supera::ImageMeta3D& meta,
+    void LArTPCMLReco3D::MergeShowerFamilyTouching(Workspace& ws, const supera::ImageMeta3D& meta,
                                                    std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
@@ -927,65 +1113,80 @@ namespace supera {
         // Direct parentage between kShapeShower => kShapeShower/kShapeDelta/kShapeMichel
         int merge_ctr = 0;
         int invalid_ctr = 0;
-        do {
-            merge_ctr = 0;
-            for (auto& label : labels) {
-                if (!label.valid) continue;
-                if (label.part.shape != supera::kShapeShower) continue;
-                if (label.part.parent_trackid == supera::kINVALID_TRACKID) continue;  // primaries can't have parents
-                // search for a possible parent
-                auto parent_trackid = kINVALID_TRACKID;
-                LOG_VERBOSE() << "   Found particle group with shape 'shower', PDG=" << label.part.pdg
-                              << "\n    track id=" << StringifyTrackID(label.part.trackid)
-                              << ", and alleged parent track id=" << StringifyTrackID(label.part.parent_trackid) << "\n";
-                // a direct parent ?
-                auto parent_index = this->InputIndex(label.part.parent_trackid);
-                if (parent_index != kINVALID_INDEX && labels[parent_index].valid)
-                    parent_trackid = label.part.parent_trackid;
-                else
-                {
-                    for (size_t shower_index = 0; shower_index < labels.size(); ++shower_index)
-                    {
-                        auto const &candidate_grp = labels[shower_index];
-                        if (candidate_grp.part.trackid == label.part.parent_trackid || !candidate_grp.valid)
-                            continue;
-                        for (auto const &trackid : candidate_grp.merged_v)
-                        {
-                            if (trackid != label.part.parent_trackid)
-                                continue;
-                            parent_trackid = static_cast<TrackID_t>(candidate_grp.part.trackid);
-                            break;
-                        }
-                        if (parent_trackid != kINVALID_TRACKID)
-                            break;
-                    }
-                }
-                if (parent_trackid == kINVALID_TRACKID || parent_trackid == label.part.trackid) continue;
-                parent_index = this->InputIndex(parent_trackid);
-                if(parent_index == kINVALID_INDEX) continue;
-                auto& parent = labels[parent_index];
-                //auto parent_type = labels[parent_trackid].part.type;
-                //if(parent_type == supera::kTrack || parent_type == supera::kNeutron) continue;
-                if (parent.part.shape != supera::kShapeShower && 
-                    parent.part.shape != supera::kShapeDelta && 
-                    parent.part.shape != supera::kShapeMichel)
-                    continue;
-                if (!parent.valid) continue;
-                if (this->IsTouching(meta, label.energy, parent.energy)) {
-                    // if parent is found, merge
-                    this->MergeParticleLabel(labels, parent_trackid, label.part.trackid);
-                    LOG_VERBOSE() << "   Merged to group w/ track id=" << StringifyTrackID(parent.part.trackid) << "\n";
-                    merge_ctr++;
+
+        // A shower only needs another look when the group holding its parent changed:
+        // children_v lists, per group owner, the showers whose parent is in that group.
+        std::vector<std::vector<size_t> > children_v(labels.size());
+        for (size_t label_index = 0; label_index < labels.size(); ++label_index) {
+            auto const& label = labels[label_index];
+            if (label.part.shape != supera::kShapeShower) continue;
+            auto parent_index = ws.InputIndex(label.part.parent_trackid);
+            if (parent_index == kINVALID_INDEX) continue;
+            children_v[ws.forest.Owner(parent_index)].push_back(label_index);
+        }
+
+        MergeWorklist worklist(labels.size());
+        size_t label_index = 0;
+        while (worklist.Next(label_index)) {
+            auto& label = labels[label_index];
+            if (!label.valid) continue;
+            if (label.part.shape != supera::kShapeShower) continue;
+            if (label.part.parent_trackid == supera::kINVALID_TRACKID) continue;  // primaries can't have parents
+            // search for a possible parent
+            auto parent_trackid = kINVALID_TRACKID;
+            LOG_VERBOSE() << "   Found particle group with shape 'shower', PDG=" << label.part.pdg
+                          << "\n    track id=" << StringifyTrackID(label.part.trackid)
+                          << ", and alleged parent track id=" << StringifyTrackID(label.part.parent_trackid) << "\n";
+            // a direct parent ?
+            auto parent_index = ws.InputIndex(label.part.parent_trackid);
+            if (parent_index != kINVALID_INDEX && labels[parent_index].valid)
+                parent_trackid = label.part.parent_trackid;
+            else if (parent_index != kINVALID_INDEX)
+            {
+                // the parent was merged: use the group that now holds it
+                auto owner_index = this->MergeOwner(ws, labels, parent_index);
+                if (owner_index != kINVALID_INDEX)
+                    parent_trackid = labels[owner_index].part.trackid;
+            }
+            if (parent_trackid == kINVALID_TRACKID || parent_trackid == label.part.trackid) continue;
+            parent_index = ws.InputIndex(parent_trackid);
+            if(parent_index == kINVALID_INDEX) continue;
+            auto& parent = labels[parent_index];
+            //auto parent_type = labels[parent_trackid].part.type;
+            //if(parent_type == supera::kTrack || parent_type == supera::kNeutron) continue;
+            if (parent.part.shape != supera::kShapeShower && 
+                parent.part.shape != supera::kShapeDelta && 
+                parent.part.shape != supera::kShapeMichel)
+                continue;
+            if (!parent.valid) continue;
+            if (this->IsTouching(ws, meta, label, parent)) {
+                // if parent is found, merge
+                this->MergeParticleLabel(ws, labels, parent_trackid, label.part.trackid);
+                LOG_VERBOSE() << "   Merged to group w/ track id=" << StringifyTrackID(parent.part.trackid) << "\n";
+                merge_ctr++;
+
+                // the parent grew and now also holds the parents of this label's children
+                auto& children = children_v[parent_index];
+                children.insert(children.end(), children_v[label_index].begin(), children_v[label_index].end());
+                children_v[label_index].clear();
+                worklist.Requeue(parent_index);
+                size_t num_waiting = 0;
+                for (auto const& child_index : children) {
+                    if (!labels[child_index].valid) continue;
+                    children[num_waiting++] = child_index;
+                    worklist.Requeue(child_index);
                 }
+                children.resize(num_waiting);
             }
-            LOG_DEBUG() << "Merge counter: " << merge_ctr << " invalid counter: " << invalid_ctr << "\n";
-        } while (merge_ctr>0);
+        }
+        LOG_DEBUG() << "Merge counter: " << merge_ctr << " invalid counter: " << invalid_ctr
+                    << " passes: " << worklist.Pass() << "\n";
     } // LArTPCMLReco3D::MergeShowerFamilyTouching()
 
 
     // ------------------------------------------------------
 
-    void LArTPCMLReco3D::MergeShowerIonizations(std::vector<supera::ParticleLabel>& labels) const
+    void LArTPCMLReco3D::MergeShowerIonizations(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         // Loop over particles of a type kIonization (=touching to its parent physically by definition)
@@ -1003,10 +1204,10 @@ namespace supera {
 
                 bool parent_found = false;
                 auto parent_trackid = kINVALID_TRACKID;
-                for(auto const& trackid : _mcpl.ParentTrackIdArray(label.part.trackid))
+                for(auto const& trackid : ws.mcpl.ParentTrackIdArray(label.part.trackid))
                 {
                     parent_trackid = trackid;
-                    auto parent_index = this->InputIndex(parent_trackid);
+                    auto parent_index = ws.InputIndex(parent_trackid);
                     if(parent_index == kINVALID_INDEX) continue;
                     if(!labels[parent_index].valid) continue;
                     parent_found = true;
@@ -1015,7 +1216,7 @@ namespace supera {
                 // if parent is found, merge
                 if (parent_found)
                 {
-                    this->MergeParticleLabel(labels,parent_trackid,label.part.trackid); 
+                    this->MergeParticleLabel(ws, labels,parent_trackid,label.part.trackid); 
                     merge_ctr++;
                 }
             } // for (grp)
@@ -1025,7 +1226,7 @@ namespace supera {
 
 
     // ------------------------------------------------------
-    void LArTPCMLReco3D::MergeShowerTouching(const supera::ImageMeta3D& meta,
+    void LArTPCMLReco3D::MergeShowerTouching(Workspace& ws, const supera::ImageMeta3D& meta,
                                              std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
@@ -1033,159 +1234,261 @@ namespace supera {
         // For each shower, find all consecutive parents of shower/michel/delta type (break if track found)
         // If there is a common parent in two list AND if two showers are physically touching, merge
         int merge_ctr = 0;
-        do
+
+        // Broad phase: only shower pairs whose bounds are within the touch distance can merge.
+        // A label that absorbs another inherits its candidates, so that the pairs visited below
+        // are a superset of those that can touch, in the same (i,j) order as a full pair scan.
+        std::vector<supera::VoxelBounds> bounds_v(labels.size());
+        for (size_t i = 0; i < labels.size(); ++i)
         {
-            merge_ctr = 0;
-            for (size_t i = 0; i < labels.size(); ++i)
+            if (labels[i].valid && labels[i].part.shape == supera::kShapeShower)
+                bounds_v[i] = labels[i].bounds;
+        }
+        auto candidates_v = SweepAndPrune(bounds_v, _touch_threshold);
+
+        // Narrow phase: two showers are in the same family when they share a shower-type ancestor
+        // within the EM chain, i.e. when their family keys (topmost such ancestor) are equal.
+        // Merging only invalidates labels, so families never join: candidates from other buckets
+        // are dropped up front. A key changes only when the shower it names gets absorbed,
+        // so members_v remembers, per key holder, the showers that must be re-keyed then.
+        std::vector<supera::TrackID_t> key_v(labels.size(), kINVALID_TRACKID);
+        std::vector<std::vector<size_t> > members_v(labels.size());
+        const auto Rekey = [&](size_t index)
+        {
+            key_v[index] = this->ShowerFamilyKey(ws, labels[index].part.trackid, labels);
+            members_v[ws.InputIndex(key_v[index])].push_back(index);
+        };
+        const auto Absorbed = [&](size_t index)
+        {
+            auto members = std::move(members_v[index]);
+            members_v[index].clear();
+            for (auto const& member : members)
             {
-                auto &label_a = labels[i];
-                if (!label_a.valid) continue;
-                if (label_a.part.shape != supera::kShapeShower) continue;
-                for (size_t j = 0; j < labels.size(); ++j)
+                if (labels[member].valid && key_v[member] == labels[index].part.trackid)
+                    Rekey(member);
+            }
+        };
+        for (size_t i = 0; i < labels.size(); ++i)
+        {
+            if (labels[i].valid && labels[i].part.shape == supera::kShapeShower)
+                Rekey(i);
+        }
+        for (size_t i = 0; i < labels.size(); ++i)
+        {
+            auto& candidates = candidates_v[i];
+            candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                            [&](size_t j) { return key_v[j] != key_v[i]; }),
+                             candidates.end());
+        }
+
+        // Merging never adds to a family (it only invalidates parents), so a pair that did not merge
+        // can only merge later once one side grew. After a merge, revisit the survivor and its neighbours.
+        MergeWorklist worklist(labels.size());
+        const auto RequeueNeighbours = [&](size_t owner)
+        {
+            worklist.Requeue(owner);
+            for (auto const& candidate : candidates_v[owner])
+            {
+                auto k = this->MergeOwner(ws, labels, candidate);
+                if (k != kINVALID_INDEX && k != owner) worklist.Requeue(k);
+            }
+        };
+
+        size_t i = 0;
+        while (worklist.Next(i))
+        {
+            auto &label_a = labels[i];
+            if (!label_a.valid) continue;
+            if (label_a.part.shape != supera::kShapeShower) continue;
+            std::set<size_t> pending;
+            for (auto const& candidate : candidates_v[i])
+            {
+                auto j = this->MergeOwner(ws, labels, candidate);
+                if (j != kINVALID_INDEX && j != i) pending.insert(j);
+            }
+            // keep the inherited candidate lists short across passes
+            candidates_v[i].assign(pending.begin(), pending.end());
+            while (!pending.empty())
+            {
+                size_t j = *pending.begin();
+                pending.erase(pending.begin());
+                auto &label_b = labels[j];
+                if (!label_b.valid) continue;
+                if (label_b.part.shape != supera::kShapeShower) continue;
+
+                // check if these showers share the parentage
+                if (key_v[i] != key_v[j]) continue;
+
+                if (this->IsTouching(ws, meta, label_a, label_b))
                 {
-                    if (i == j) continue;
-                    auto &label_b = labels[j];
-                    if (!label_b.valid) continue;
-                    if (label_b.part.shape != supera::kShapeShower) continue;
-
-                    // check if these showers share the parentage
-                    // list a's parents
-                    std::set<supera::TrackID_t> parent_list_a;
-                    std::set<supera::TrackID_t> parent_list_b;
-
-                    auto parents_a = this->ParentShowerTrackIDs(label_a.part.trackid, labels);
-                    for (auto const &parent_trackid : parents_a) parent_list_a.insert(parent_trackid);
-                    parent_list_a.insert(label_a.part.trackid);
-
-                    auto parents_b = this->ParentShowerTrackIDs(label_b.part.trackid, labels);
-                    for (auto const &parent_trackid : parents_b) parent_list_b.insert(parent_trackid);
-                    parent_list_b.insert(label_b.part.trackid);
-
-                    bool same_family = false;
-                    for (auto const &parent_trackid : parent_list_a)
-                    {
-                        if (parent_list_b.find(parent_trackid) != parent_list_b.end())
-                            same_family = true;
-                        if (same_family) break;
-                    }
-                    for (auto const &parent_trackid : parent_list_b)
+                    merge_ctr++;
+                    if (label_a.energy.size() > label_b.energy.size())
                     {
-                        if (parent_list_a.find(parent_trackid) != parent_list_a.end())
-                            same_family = true;
-                        if (same_family) break;
+                        this->MergeParticleLabel(ws, labels, label_a.part.trackid, label_b.part.trackid);
+                        Absorbed(j);
+                        for (auto const& candidate : candidates_v[j])
+                        {
+                            auto k = this->MergeOwner(ws, labels, candidate);
+                            if (k != kINVALID_INDEX && k != i && k > j) pending.insert(k);
+                        }
+                        candidates_v[i].insert(candidates_v[i].end(), candidates_v[j].begin(), candidates_v[j].end());
+                        RequeueNeighbours(i);
                     }
-
-                    if (same_family && this->IsTouching(meta, label_a.energy, label_b.energy))
+                    else
                     {
-                        if (label_a.energy.size() > label_b.energy.size())
-                            this->MergeParticleLabel(labels, label_a.part.trackid, label_b.part.trackid);
-                        else
-                            this->MergeParticleLabel(labels, label_b.part.trackid, label_a.part.trackid);
-                        merge_ctr++;
+                        this->MergeParticleLabel(ws, labels, label_b.part.trackid, label_a.part.trackid);
+                        Absorbed(i);
+                        candidates_v[j].insert(candidates_v[j].end(), candidates_v[i].begin(), candidates_v[i].end());
+                        RequeueNeighbours(j);
+                        // label_a is now empty: nothing else can touch it in this pass
+                        break;
                     }
                 }
             }
-            LOG_INFO() << "Merge counter: " << merge_ctr << "\n";
-        } while (merge_ctr > 0);
+        }
+        LOG_DEBUG() << "Merge counter: " << merge_ctr << " passes: " << worklist.Pass() << "\n";
     } // LArTPCMLReco3D::MergeShowerTouching()
 
     // ------------------------------------------------------
 
-    void LArTPCMLReco3D::MergeShowerTouchingElectron(const supera::ImageMeta3D& meta,
+    void LArTPCMLReco3D::MergeShowerTouchingElectron(Workspace& ws, const supera::ImageMeta3D& meta,
                                                       std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
-        size_t merge_ctr = 1;
-        while (merge_ctr)
+        size_t merge_ctr = 0;
+
+        const auto IsCandidate = [](const supera::ParticleLabel& label)
         {
-            merge_ctr = 0;
-            for (auto &label : labels)
+            return std::abs(label.part.pdg) == 11 &&
+                (label.part.type == kPhotoElectron ||
+                 label.part.type == kIonization ||
+                 label.part.type == kCompton ||
+                 label.part.type == kConversion);
+        };
+
+        // An electron that touched none of its parents can only touch one once that parent grew:
+        // descendants_v lists, per label, the candidate electrons that have it among their parents.
+        std::vector<std::vector<size_t> > descendants_v(labels.size());
+        for (size_t label_index = 0; label_index < labels.size(); ++label_index)
+        {
+            if (!IsCandidate(labels[label_index])) continue;
+            for (auto const& parent_trackid : ws.mcpl.ParentTrackIdArray(labels[label_index].part.trackid))
             {
-                //if (!label.valid || label.energy.size() < 1 || label.shape() != supera::kShapeLEScatter) continue;
-                if( !label.valid || label.energy.size()<1 || 
-                    label.energy.size()>_compton_size ||
-                    std::abs(label.part.pdg) != 11)
-                    continue;
-                if( label.part.type != kPhotoElectron && 
-                    label.part.type != kIonization && 
-                    label.part.type != kCompton &&
-                    label.part.type != kConversion)
-                    continue;
+                auto parent_index = ws.InputIndex(parent_trackid);
+                if (parent_index != kINVALID_INDEX) descendants_v[parent_index].push_back(label_index);
+            }
+        }
+
+        MergeWorklist worklist(labels.size());
+        size_t label_index = 0;
+        while (worklist.Next(label_index))
+        {
+            auto &label = labels[label_index];
+            //if (!label.valid || label.energy.size() < 1 || label.shape() != supera::kShapeLEScatter) continue;
+            if( !label.valid || label.energy.size()<1 || 
+                label.energy.size()>_compton_size ||
+                !IsCandidate(label))
+                continue;
 
-                auto const &parents = _mcpl.ParentTrackIdArray(label.part.trackid);
+            auto const &parents = ws.mcpl.ParentTrackIdArray(label.part.trackid);
 
-                LOG_VERBOSE() << "Inspecting LEScatter Track ID " << StringifyTrackID(label.part.trackid)
-                            << " PDG " << label.part.pdg
-                            << " " << label.part.process << "\n";
-                LOG_VERBOSE() << "  ... parents:\n";
-                for(auto const& parent_trackid : parents)
-                    LOG_VERBOSE() << "     "<< StringifyTrackID(parent_trackid) << "\n";
+            LOG_VERBOSE() << "Inspecting LEScatter Track ID " << StringifyTrackID(label.part.trackid)
+                        << " PDG " << label.part.pdg
+                        << " " << label.part.process << "\n";
+            LOG_VERBOSE() << "  ... parents:\n";
+            for(auto const& parent_trackid : parents)
+                LOG_VERBOSE() << "     "<< StringifyTrackID(parent_trackid) << "\n";
 
-                for (auto const &parent_trackid : parents)
+            for (auto const &parent_trackid : parents)
+            {
+                auto parent_index = ws.InputIndex(parent_trackid);
+                if(parent_index == kINVALID_INDEX) continue;
+                auto &parent = labels[parent_index];
+                if (!parent.valid || parent.energy.size() < 1) continue;
+                if (this->IsTouching(ws, meta, label, parent))
                 {
-                    auto parent_index = this->InputIndex(parent_trackid);
-                    if(parent_index == kINVALID_INDEX) continue;
-                    auto &parent = labels[parent_index];
-                    if (!parent.valid || parent.energy.size() < 1) continue;
-                    if (this->IsTouching(meta, label.energy, parent.energy))
-                    {
-                        LOG_VERBOSE() << "Merging LEScatter track id = " << StringifyTrackID(label.part.trackid)
-                                    << " into touching parent shower group (id=" << StringifyInstanceID(parent.part.group_id) << ")"
-                                    << " with track id = " << StringifyTrackID(parent.part.trackid) << "\n";
-                        this->MergeParticleLabel(labels,parent_trackid,label.part.trackid);
-                        merge_ctr++;
-                        break;
-                    }
-                } // for (parent_trackid)
-            } // for (grp)
-        } // while (merge_ctr)
+                    LOG_VERBOSE() << "Merging LEScatter track id = " << StringifyTrackID(label.part.trackid)
+                                << " into touching parent shower group (id=" << StringifyInstanceID(parent.part.group_id) << ")"
+                                << " with track id = " << StringifyTrackID(parent.part.trackid) << "\n";
+                    this->MergeParticleLabel(ws, labels,parent_trackid,label.part.trackid);
+                    merge_ctr++;
+                    worklist.Requeue(parent_index);
+                    for (auto const& descendant_index : descendants_v[parent_index])
+                        worklist.Requeue(descendant_index);
+                    break;
+                }
+            } // for (parent_trackid)
+        } // while (worklist)
+        LOG_DEBUG() << "Merge counter: " << merge_ctr << " passes: " << worklist.Pass() << "\n";
     } // LArTPCMLReco3D::MergeShowerTouchingElectron()
 
     // ------------------------------------------------------
 
-    void LArTPCMLReco3D::MergeShowerTouchingLEScatter(const supera::ImageMeta3D& meta,
+    void LArTPCMLReco3D::MergeShowerTouchingLEScatter(Workspace& ws, const supera::ImageMeta3D& meta,
                                                       std::vector<supera::ParticleLabel>& labels) const
     {
         LOG_DEBUG() << "starting" << std::endl;
-        size_t merge_ctr = 1;
-        while (merge_ctr)
+        size_t merge_ctr = 0;
+
+        // Broad phase over all labels with voxels (LEScatter ones included, so that a
+        // destination that absorbed a nearby LEScatter is found through its owner)
+        std::vector<supera::VoxelBounds> bounds_v(labels.size());
+        for (size_t label_index = 0; label_index < labels.size(); ++label_index)
         {
-            merge_ctr = 0;
-            for (auto &label : labels)
-            {
-                //if (!label.valid || label.energy.size() < 1 || label.shape() != supera::kShapeLEScatter) continue;
-                if( !label.valid || label.energy.size()<1 || 
-                    label.energy.size()>_lescatter_size ||
-                    label.part.shape != supera::kShapeLEScatter)
-                    continue;
+            if (labels[label_index].valid && labels[label_index].energy.size())
+                bounds_v[label_index] = labels[label_index].bounds;
+        }
+        auto candidates_v = SweepAndPrune(bounds_v, _touch_threshold);
 
-                if (label.part.type == supera::kNeutron || label.part.type == supera::kNucleus)
-                    continue;
+        // Only LEScatter labels are absorbed here, so a destination grows only by the voxels of
+        // the label it absorbed: only the labels near that one need another look.
+        MergeWorklist worklist(labels.size());
+        size_t label_index = 0;
+        while (worklist.Next(label_index))
+        {
+            auto &label = labels[label_index];
+            //if (!label.valid || label.energy.size() < 1 || label.shape() != supera::kShapeLEScatter) continue;
+            if( !label.valid || label.energy.size()<1 || 
+                label.energy.size()>_lescatter_size ||
+                label.part.shape != supera::kShapeLEScatter)
+                continue;
 
-                auto const &parents = _mcpl.ParentTrackIdArray(label.part.trackid);
+            if (label.part.type == supera::kNeutron || label.part.type == supera::kNucleus)
+                continue;
 
-                LOG_VERBOSE() << "Inspecting LEScatter Track ID " << StringifyTrackID(label.part.trackid)
-                            << " PDG " << label.part.pdg
-                            << " " << label.part.process << "\n";
-                LOG_VERBOSE() << "  ... parents:\n";
-                for(auto const& parent_trackid : parents)
-                    LOG_VERBOSE() << "     "<< StringifyTrackID(parent_trackid) << "\n";
+            auto const &parents = ws.mcpl.ParentTrackIdArray(label.part.trackid);
 
-                for(auto &dest : labels) {
-                    if(!dest.valid || dest.part.shape == supera::kShapeLEScatter)
-                        continue;
-                    if(this->IsTouching(meta, label.energy, dest.energy))
-                    {
-                        LOG_VERBOSE() << "Merging LEScatter track id = " << StringifyTrackID(label.part.trackid)
-                                    << " into touching non-LESCatter group (id=" << StringifyInstanceID(dest.part.group_id) << ")"
-                                    << " with track id = " << StringifyTrackID(dest.part.trackid) << "\n";
-                        this->MergeParticleLabel(labels,dest.part.trackid,label.part.trackid);
-                        merge_ctr++;
-                        break;
-                    }
+            LOG_VERBOSE() << "Inspecting LEScatter Track ID " << StringifyTrackID(label.part.trackid)
+                        << " PDG " << label.part.pdg
+                        << " " << label.part.process << "\n";
+            LOG_VERBOSE() << "  ... parents:\n";
+            for(auto const& parent_trackid : parents)
+                LOG_VERBOSE() << "     "<< StringifyTrackID(parent_trackid) << "\n";
+
+            // Candidates are the current owners of the labels that were near this one
+            std::set<size_t> dest_index_v;
+            for(auto const& candidate : candidates_v[label_index]) {
+                auto dest_index = this->MergeOwner(ws, labels, candidate);
+                if(dest_index != kINVALID_INDEX) dest_index_v.insert(dest_index);
+            }
+            for(auto const& dest_index : dest_index_v) {
+                auto &dest = labels[dest_index];
+                if(!dest.valid || dest.part.shape == supera::kShapeLEScatter)
+                    continue;
+                if(this->IsTouching(ws, meta, label, dest))
+                {
+                    LOG_VERBOSE() << "Merging LEScatter track id = " << StringifyTrackID(label.part.trackid)
+                                << " into touching non-LESCatter group (id=" << StringifyInstanceID(dest.part.group_id) << ")"
+                                << " with track id = " << StringifyTrackID(dest.part.trackid) << "\n";
+                    this->MergeParticleLabel(ws, labels,dest.part.trackid,label.part.trackid);
+                    merge_ctr++;
+                    for(auto const& candidate : candidates_v[label_index])
+                        worklist.Requeue(candidate);
+                    break;
                 }
-            } // for (grp)
-        } // while (merge_ctr)
+            }
+        } // while (worklist)
+        LOG_DEBUG() << "Merge counter: " << merge_ctr << " passes: " << worklist.Pass() << "\n";
     } // LArTPCMLReco3D::MergeShowerTouchingLEScatter()
 
     // ------------------------------------------------------
@@ -1193,71 +1496,44 @@ namespace supera {
     bool LArTPCMLReco3D::IsTouching(const ImageMeta3D& meta, const VoxelSet& vs1, const VoxelSet& vs2) const
     {
         LOG_DEBUG() << "starting" << std::endl;
-        bool touching = false;
-        size_t ix1, iy1, iz1;
-        size_t ix2, iy2, iz2;
-        size_t diffx, diffy, diffz;
-
-        // Test1: is there an overlapping voxel?
-        if(vs1.size()<vs2.size()) {
-            for(auto const& vox : vs1.as_vector()) 
-            {
-                auto const& overlap = vs2.find(vox.id());
-                if(overlap.id() != kINVALID_VOXELID)
-                    return true;
-            }
-        }else{
-            for(auto const& vox : vs2.as_vector()) 
-            {
-                auto const& overlap = vs1.find(vox.id());
-                if(overlap.id() != kINVALID_VOXELID)
-                    return true;
-            }
-        }
-
+        // Overlapping voxels are at distance 0, so a single neighborhood query covers both cases
+        return meta.touching(vs1, vs2, _touch_threshold);
+    } // LArTPCMLReco3D::IsTouching()
 
-        // Test2: is there a voxel close enough? (distance calculation)
-        for (auto const &vox1 : vs1.as_vector())
-        {
-            meta.id_to_xyz_index(vox1.id(), ix1, iy1, iz1);
-            for (auto const &vox2 : vs2.as_vector())
-            {
-                meta.id_to_xyz_index(vox2.id(), ix2, iy2, iz2);
-                if (ix1 > ix2) diffx = ix1 - ix2; else diffx = ix2 - ix1;
-                if (iy1 > iy2) diffy = iy1 - iy2; else diffy = iy2 - iy1;
-                if (iz1 > iz2) diffz = iz1 - iz2; else diffz = iz2 - iz1;
-                touching = diffx <= _touch_threshold && diffy <= _touch_threshold && diffz <= _touch_threshold;
-                if (touching)
-                {
-                    LOG_VERBOSE()<<"Touching ("<<ix1<<","<<iy1<<","<<iz1<<") ("<<ix2<<","<<iy2<<","<<iz2<<")\n";
-                    break;
-                }
-            }
-            if (touching) break;
-        }
+    bool LArTPCMLReco3D::IsTouching(Workspace& ws, const ImageMeta3D& meta,
+                                    const ParticleLabel& label1, const ParticleLabel& label2) const
+    {
+        if(!label1.bounds.near(label2.bounds, _touch_threshold))
+            return false;
+        ws.stats.count(kCounterIsTouching);
+        return this->IsTouching(meta, label1.energy, label2.energy);
+    }
 
-        return touching;
-    } // LArTPCMLReco3D::IsTouching()
+    Index_t LArTPCMLReco3D::MergeOwner(Workspace& ws, const std::vector<supera::ParticleLabel>& labels, Index_t index) const
+    {
+        index = ws.forest.Owner(index);
+        return labels[index].valid ? index : kINVALID_INDEX;
+    }
 
 
     // ------------------------------------------------------
 
     std::vector<supera::TrackID_t>
-    LArTPCMLReco3D::ParentShowerTrackIDs(TrackID_t trackid,
+    LArTPCMLReco3D::ParentShowerTrackIDs(const Workspace& ws, TrackID_t trackid,
                                          const std::vector<supera::ParticleLabel>& labels,
                                          bool include_lescatter) const
     {
         LOG_DEBUG() << "starting" << std::endl;
         std::vector<supera::TrackID_t> result;
-        auto target_index = this->InputIndex(trackid);
+        auto target_index = ws.InputIndex(trackid);
         if( target_index == kINVALID_INDEX )
             return result;
-        auto const& parents = _mcpl.ParentTrackIdArray(trackid);
+        auto const& parents = ws.mcpl.ParentTrackIdArray(trackid);
         result.reserve(parents.size());
 
         for(auto const& parent_trackid : parents) {
 
-            auto parent_index = this->InputIndex(parent_trackid);
+            auto parent_index = ws.InputIndex(parent_trackid);
 
             if(parent_index == kINVALID_INDEX) continue;
 
@@ -1279,6 +1555,38 @@ namespace supera {
     } // LArTPCMLReco3D::ParentShowerTrackIDs()
 
     // ------------------------------------------------------
+    supera::TrackID_t
+    LArTPCMLReco3D::ShowerFamilyKey(const Workspace& ws, TrackID_t trackid,
+                                    const std::vector<supera::ParticleLabel>& labels) const
+    {
+        // same walk as ParentShowerTrackIDs(), keeping only the last match
+        auto result = trackid;
+        if( ws.InputIndex(trackid) == kINVALID_INDEX )
+            return result;
+
+        for(auto const& parent_trackid : ws.mcpl.ParentTrackIdArray(trackid)) {
+
+            auto parent_index = ws.InputIndex(parent_trackid);
+
+            if(parent_index == kINVALID_INDEX) continue;
+
+            auto const& grp = labels[parent_index];
+
+            if(grp.part.shape == supera::kShapeTrack ||
+               grp.part.shape == supera::kShapeUnknown)
+                break;
+
+            if(!grp.valid) continue;
+
+            if(grp.part.shape == supera::kShapeMichel ||
+               grp.part.shape == supera::kShapeShower ||
+               grp.part.shape == supera::kShapeDelta)
+                result = parent_trackid;
+        }
+        return result;
+    } // LArTPCMLReco3D::ShowerFamilyKey()
+
+    // ------------------------------------------------------
 
 
 
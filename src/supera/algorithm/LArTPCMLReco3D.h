@@ -3,6 +3,10 @@
 
 #include "LabelBase.h"
 #include "ParticleIndex.h"
+#include "MergeForest.h"
+#include "supera/base/WorkStealingPool.h"
+#include <functional>
+#include <memory>
 
 namespace supera {
 
@@ -13,7 +17,26 @@ namespace supera {
 	class LArTPCMLReco3D : public LabelAlgorithm {
 	public:
 		LArTPCMLReco3D(std::string name="LArTPCMLReco3D");
-		EventOutput Generate(const EventInput& data, const ImageMeta3D& meta) override;
+
+		/**
+			\struct Workspace
+			Per-event working state of Generate (particle genealogy and merge bookkeeping). \n
+			The configured algorithm itself is never modified, so concurrent calls are safe as long as each uses its own workspace.
+		*/
+		struct Workspace {
+			ParticleIndex mcpl;  ///< genealogy of the input particles
+			MergeForest forest;  ///< which labels were merged together (filled by MergeParticleLabel)
+			EventStats stats;    ///< timings and counters of the last event (also recorded into the algorithm's RunStats, if set)
+
+			/// Return the input index from the track id
+			Index_t InputIndex(const TrackID_t& tid) const
+			{ return mcpl.TrackIdToIndex(tid); }
+		};
+
+		EventOutput Generate(const EventInput& data, const ImageMeta3D& meta) const override;
+
+		/// Same as above using a caller-provided workspace (e.g. one per thread, to reuse its buffers)
+		EventOutput Generate(const EventInput& data, const ImageMeta3D& meta, Workspace& ws) const;
 
 	protected:
 		
@@ -21,51 +44,57 @@ namespace supera {
 
 	private:
 
+        /// Call fn(index, thread) for every index in [0,num_items) on the per-label thread pool (NumThreads),
+        /// or serially when the pool has one thread or the work (e.g. number of EDeps) is too small to pay off.
+        /// thread is in [0,_pool->num_threads()), for per-thread scratch.
+        void ParallelFor(size_t num_items, size_t work, const std::function<void(size_t,size_t)>& fn) const;
+
         // ----- label making -----
         std::vector<supera::ParticleLabel>
-        InitializeLabels(const EventInput &evtInput, const supera::ImageMeta3D &meta) const;
+        InitializeLabels(Workspace& ws, const EventInput &evtInput, const supera::ImageMeta3D &meta) const;
 
-	    void BuildOutputLabels(std::vector<supera::ParticleLabel>& labels,
+	    void BuildOutputLabels(const Workspace& ws, std::vector<supera::ParticleLabel>& labels,
 	        supera::EventOutput& result, 
 	        const std::vector<TrackID_t>& output2trackid,
 	        const supera::VoxelSet& unassociated_voxels) const;
 
         // ----- internal label merging methods -----
         /// Merge deltas into their parents if they have fewer than threshold voxels
-        void MergeDeltas(std::vector<supera::ParticleLabel>& labels) const;
+        void MergeDeltas(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
 
         /// Combine particles from e+/e- pair conversion into their parent particles
-        void MergeShowerConversion(std::vector<supera::ParticleLabel>& labels) const;
+        void MergeShowerConversion(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
 
         /// Combine deltas/Michels/etc that derive from a 'EM shower' shape parent into their parent
-        void MergeShowerFamilyTouching(const supera::ImageMeta3D& meta,
+        void MergeShowerFamilyTouching(Workspace& ws, const supera::ImageMeta3D& meta,
                                        std::vector<supera::ParticleLabel>& labels) const;
 
         /// Combine 'EM shower' type particles that are 'ionization' process with their parents (they are always touching)
-        void MergeShowerIonizations(std::vector<supera::ParticleLabel>& labels) const;
+        void MergeShowerIonizations(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
 
         /// Combine instances of two shower groups that share a common ancestor and are touching
-        void MergeShowerTouching(const supera::ImageMeta3D& meta, std::vector<supera::ParticleLabel>& labels) const;
+        void MergeShowerTouching(Workspace& ws, const supera::ImageMeta3D& meta, std::vector<supera::ParticleLabel>& labels) const;
 
         /// Combine 'LE scatter' type particles that are touching their parents with them
-        void MergeShowerTouchingElectron(const supera::ImageMeta3D& meta,
+        void MergeShowerTouchingElectron(Workspace& ws, const supera::ImageMeta3D& meta,
                                          std::vector<supera::ParticleLabel>& labels) const;
 
-	    void MergeShowerTouchingLEScatter(const supera::ImageMeta3D& meta,
+	    void MergeShowerTouchingLEScatter(Workspace& ws, const supera::ImageMeta3D& meta,
     	                                  std::vector<supera::ParticleLabel>& labels) const;
 
         /// Identify and register a set of particles to be stored in the output
-        void RegisterOutputParticles(const std::vector<TrackID_t> &trackid2index,
+        void RegisterOutputParticles(const Workspace& ws,
         	std::vector<supera::ParticleLabel> &inputLabels,
         	std::vector<TrackID_t> &output2trackid,
-        	std::vector<Index_t> &trackid2output) const;
+        	std::vector<Index_t> &input2output) const;
 
         /// Assign Group ID: this only 
-    	void SetGroupID(std::vector<supera::ParticleLabel>& labels) const;
+    	void SetGroupID(const Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
 
+        /// Number the distinct ancestor vertices (exact match, or after Vertex::approx if InteractionVertexPrecision is set)
     	void SetInteractionID(std::vector<supera::ParticleLabel>& labels) const;
 
-	    void SetAncestorAttributes(std::vector<supera::ParticleLabel>& labels) const;
+	    void SetAncestorAttributes(const Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
 
         // -----  internal group-sanitizing methods -----
         /// The first step of the true trajectory is important, and sometimes winds up unset.
@@ -78,12 +107,15 @@ namespace supera {
 	    
         // -----  utility methods -----
         /// filter out any voxels voxels that have energy below the given threshold
-        void ApplyEnergyThreshold(std::vector<supera::ParticleLabel>& labels) const;
+        void ApplyEnergyThreshold(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
 
-	    void MergeParticleLabel(std::vector<supera::ParticleLabel>& labels,
+	    void MergeParticleLabel(Workspace& ws, std::vector<supera::ParticleLabel>& labels,
 	    	TrackID_t dest_trackid,
 	    	TrackID_t target_trackid) const;
 
+        /// fill merged_v (and merge_id of the merged particles) of every valid label from the merge forest
+        void FillMergedTrackIDs(Workspace& ws, std::vector<supera::ParticleLabel>& labels) const;
+
 	    void SetSemanticType(std::vector<supera::ParticleLabel>& labels) const;
 
 	    void SetSemanticPriority(std::vector<size_t>& order);
@@ -94,17 +126,24 @@ namespace supera {
         /// Do the two given VoxelSets overlap at all?
         bool IsTouching(const ImageMeta3D& meta, const VoxelSet& vs1, const VoxelSet& vs2) const;
 
-        /// Return the input index from the track id
-        Index_t InputIndex(const TrackID_t& tid) const
-        { return tid >= _mcpl.TrackIdToIndex().size() ? kINVALID_INDEX : _mcpl.TrackIdToIndex()[tid]; }
+        /// Same as above for the energy voxels of two labels, rejecting early on their bounds
+        bool IsTouching(Workspace& ws, const ImageMeta3D& meta, const ParticleLabel& label1, const ParticleLabel& label2) const;
+
+        /// Index of the valid label that currently holds the voxels of the label at index (kINVALID_INDEX if none)
+        Index_t MergeOwner(Workspace& ws, const std::vector<supera::ParticleLabel>& labels, Index_t index) const;
 
         /// Get a list of all the GEANT4 tracks that are in the ancestry chain of the given one,
         /// constrained to staying within the same EM shower.
         std::vector<supera::TrackID_t>
-        ParentShowerTrackIDs(TrackID_t trackid,
+        ParentShowerTrackIDs(const Workspace& ws, TrackID_t trackid,
                              const std::vector<supera::ParticleLabel>& labels,
                              bool include_lescatter=false) const;
 
+        /// Family key of a shower: the most distant track in its \ref ParentShowerTrackIDs() (itself if there are none).
+        /// Two showers share an entry of their ParentShowerTrackIDs() (themselves included) exactly when their keys are equal.
+        supera::TrackID_t ShowerFamilyKey(const Workspace& ws, TrackID_t trackid,
+                                          const std::vector<supera::ParticleLabel>& labels) const;
+
         /// Get a list of all the GEANT4 tracks that are in the ancestry chain of the given one.
         /// Most recent ancestor at index 0.
         //std::vector<supera::TrackID_t> ParentTrackIDs(size_t trackid) const;
@@ -119,8 +158,9 @@ namespace supera {
         double _edep_threshold;
         bool _store_lescatter;
         bool _rewrite_interactionid;
+        int _interaction_vtx_precision; ///< decimal digits kept when matching interaction vertices (<0: exact match)
+        std::unique_ptr<WorkStealingPool> _pool; ///< threads for the per-label stages of one event (NumThreads, default 1)
         BBox3D _world_bounds;
-        ParticleIndex _mcpl;
 	};
 }
 
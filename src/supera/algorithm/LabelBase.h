@@ -19,7 +19,9 @@ namespace supera {
 
 		virtual ~LabelAlgorithm() {}
 
-		virtual EventOutput Generate(const EventInput& data, const ImageMeta3D& meta) = 0;
+		/// Label one event. Implementations keep per-event state out of the algorithm so that
+		/// one configured instance can be called from several threads at once.
+		virtual EventOutput Generate(const EventInput& data, const ImageMeta3D& meta) const = 0;
 
 	};
 }
@@ -0,0 +1,71 @@
+#ifndef __MERGEFOREST_CXX__
+#define __MERGEFOREST_CXX__
+
+#include "MergeForest.h"
+#include "supera/base/meatloaf.h"
+
+namespace supera {
+
+    void MergeForest::Reset(size_t num)
+    {
+        _parent.resize(num);
+        _size.assign(num, 1);
+        _owner.resize(num);
+        _tail.resize(num);
+        _next.assign(num, kINVALID_INDEX);
+        for (size_t i = 0; i < num; ++i)
+            _parent[i] = _owner[i] = _tail[i] = i;
+    }
+
+    Index_t MergeForest::Find(Index_t index)
+    {
+        if (index >= _parent.size())
+            throw meatloaf("MergeForest: index " + std::to_string(index) + " out of range");
+        Index_t root = index;
+        while (_parent[root] != root) root = _parent[root];
+        // path compression
+        while (_parent[index] != root) {
+            Index_t next = _parent[index];
+            _parent[index] = root;
+            index = next;
+        }
+        return root;
+    }
+
+    Index_t MergeForest::Owner(Index_t index)
+    {
+        return _owner[Find(index)];
+    }
+
+    void MergeForest::Merge(Index_t dest, Index_t source)
+    {
+        Index_t dest_root = Find(dest);
+        Index_t source_root = Find(source);
+        if (dest_root == source_root) return;
+
+        // append the source members after the dest members
+        _next[_tail[dest_root]] = _owner[source_root];
+        Index_t owner = _owner[dest_root];
+        Index_t tail = _tail[source_root];
+
+        // union by size
+        Index_t root = dest_root, child = source_root;
+        if (_size[root] < _size[child]) std::swap(root, child);
+        _parent[child] = root;
+        _size[root] += _size[child];
+        _owner[root] = owner;
+        _tail[root] = tail;
+    }
+
+    std::vector<Index_t> MergeForest::Members(Index_t index)
+    {
+        Index_t root = Find(index);
+        std::vector<Index_t> result;
+        result.reserve(_size[root] - 1);
+        for (Index_t member = _next[_owner[root]]; member != kINVALID_INDEX; member = _next[member])
+            result.push_back(member);
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,58 @@
+/**
+ * \file MergeForest.h
+ *
+ * \ingroup algorithm
+ *
+ * \brief Class def header for a class MergeForest
+ *
+ */
+
+/** \addtogroup algorithm
+    @{*/
+#ifndef __MERGEFOREST_H__
+#define __MERGEFOREST_H__
+
+#include "supera/base/SuperaType.h"
+#include <vector>
+
+namespace supera {
+
+    /**
+     \class MergeForest
+     \brief Disjoint-set forest over input particle indices recording which labels were merged together. \n
+     Uses union by size and path compression. Each set also remembers the index of the label holding \n
+     its voxels (the "owner") and its members in the order they were merged.
+    */
+    class MergeForest {
+
+    public:
+
+        MergeForest() = default;
+
+        /// Reset to num singleton sets
+        void Reset(size_t num);
+        /// Number of elements
+        inline size_t Size() const { return _parent.size(); }
+        /// Index of the label that holds the voxels of the set containing index
+        Index_t Owner(Index_t index);
+        /// True if both indices belong to the same set
+        inline bool SameSet(Index_t a, Index_t b) { return Find(a) == Find(b); }
+        /// Merge the set of source into the set of dest. The owner of dest's set stays the owner.
+        void Merge(Index_t dest, Index_t source);
+        /// Members of the set containing index in merge order, excluding its owner
+        std::vector<Index_t> Members(Index_t index);
+
+    private:
+
+        Index_t Find(Index_t index);
+
+        std::vector<Index_t> _parent; ///< forest parent (itself for a root)
+        std::vector<size_t>  _size;   ///< set size, valid for roots
+        std::vector<Index_t> _owner;  ///< owner label index, valid for roots
+        std::vector<Index_t> _tail;   ///< last member in merge order, valid for roots
+        std::vector<Index_t> _next;   ///< next member in merge order (kINVALID_INDEX at the end)
+    };
+}
+
+#endif
+/** @} */ // end of doxygen group
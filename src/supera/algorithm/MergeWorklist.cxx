@@ -0,0 +1,35 @@
+#ifndef __MERGEWORKLIST_CXX__
+#define __MERGEWORKLIST_CXX__
+
+#include "MergeWorklist.h"
+
+namespace supera {
+
+    MergeWorklist::MergeWorklist(size_t num)
+    : _cursor(0)
+    , _pass(1)
+    {
+        for (size_t i = 0; i < num; ++i)
+            _current.insert(_current.end(), i);
+    }
+
+    bool MergeWorklist::Next(size_t& index)
+    {
+        if (_current.empty()) {
+            if (_next.empty()) return false;
+            _current.swap(_next);
+            ++_pass;
+        }
+        _cursor = index = *_current.begin();
+        _current.erase(_current.begin());
+        return true;
+    }
+
+    void MergeWorklist::Requeue(size_t index)
+    {
+        if (index > _cursor) _current.insert(index);
+        else _next.insert(index);
+    }
+}
+
+#endif
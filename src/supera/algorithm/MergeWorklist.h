@@ -0,0 +1,51 @@
+/**
+ * \file MergeWorklist.h
+ *
+ * \ingroup algorithm
+ *
+ * \brief Class def header for a class MergeWorklist
+ *
+ */
+
+/** \addtogroup algorithm
+    @{*/
+#ifndef __MERGEWORKLIST_H__
+#define __MERGEWORKLIST_H__
+
+#include <cstddef>
+#include <set>
+
+namespace supera {
+
+    /**
+     \class MergeWorklist
+     \brief Order of label visits for the fixed-point merge passes. \n
+     The first pass visits every label in ascending index order. After that only labels that were \n
+     requeued are visited, still in ascending order within each pass, so the merges happen in the \n
+     same order as repeating full passes until nothing merges.
+    */
+    class MergeWorklist {
+
+    public:
+
+        /// Queue every index in [0,num) for the first pass
+        MergeWorklist(size_t num);
+
+        /// Pop the next index to visit. Returns false once no pass is left (the fixed point).
+        bool Next(size_t& index);
+        /// Visit index again: later in this pass if it comes after the current one, otherwise in the next pass
+        void Requeue(size_t index);
+        /// Number of passes started so far
+        inline size_t Pass() const { return _pass; }
+
+    private:
+
+        std::set<size_t> _current; ///< indices left to visit in this pass
+        std::set<size_t> _next;    ///< indices to visit in the next pass
+        size_t _cursor;            ///< index being visited
+        size_t _pass;              ///< pass counter
+    };
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -35,8 +35,6 @@ namespace supera{
     _ancestor_trackid_v.resize(larmcp_v.size());
     _ancestor_index_v.resize(larmcp_v.size());
     _ancestor_pdg_v.resize(larmcp_v.size());
-    _trackid2index.resize(larmcp_v.size());
-    _parent_history_v.resize(larmcp_v.size());
 
     for(size_t i=0; i<larmcp_v.size(); ++i) {
       _pdgcode_v[i] = _parent_pdg_v[i] = _ancestor_pdg_v[i] = supera::kINVALID_PDG;
@@ -44,11 +42,6 @@ namespace supera{
       _trackid_v[i] = _parent_trackid_v[i] = _ancestor_trackid_v[i] = supera::kINVALID_TRACKID;
     }
 
-    _trackid2index.resize(std::max(_trackid2index.size(),larmcp_v.size()));
-    for(auto& v : _trackid2index) v = supera::kINVALID_INDEX;
-
-    for(auto& history : _parent_history_v) history.clear();
-
     // fill in the ParticleIndex's working structures.
 
     // first: create the mapping between GEANT4 trackid <-> index in the particle array
@@ -63,15 +56,14 @@ namespace supera{
       _trackid_v[index] = mcpart.trackid;
       _pdgcode_v[index] = abs(mcpart.pdg);
       _parent_trackid_v[index] = mcpart.parent_trackid;
-      if(mcpart.trackid >= _trackid2index.size()) _trackid2index.resize(mcpart.trackid+1, supera::kINVALID_INDEX);
-      _trackid2index[mcpart.trackid] = index;
     }
+    _trackid2index.assign(_trackid_v);
+    _trackid_end = larmcp_v.size();
+    if(_trackid2index.size() && _trackid2index.max_trackid() >= _trackid_end)
+      _trackid_end = _trackid2index.max_trackid() + 1;
 
 
-    // now fill in the mapping between the index in the particle array <-> Parent/Ancestor info.
-    // (note that for our purposes here, 'ancestor' is the *primary* particle that sits
-    //  at the top of the hierarchy containing this particle.  if this particle is itself primary,
-    //  it's its own ancestor.)
+    // now fill in the mapping between the index in the particle array <-> Parent info.
     for(size_t index=0; index<larmcp_v.size(); ++index) {
 
       auto const& mcpart = larmcp_v[index].part;
@@ -85,65 +77,87 @@ namespace supera{
       // Attempt to find the parent PDG code and the input index
       supera::TrackID_t mother_id  = mcpart.parent_trackid;
       supera::Index_t mother_index = supera::kINVALID_INDEX;
-      if(mother_id < _trackid2index.size()) {
-        mother_index = _trackid2index[mother_id];
-        if(mother_index != supera::kINVALID_INDEX) {
-          _parent_pdg_v[index] = larmcp_v[mother_index].part.pdg;
-          _parent_index_v[index] = mother_index;
-        }
+      mother_index = _trackid2index.find(mother_id);
+      if(mother_index != supera::kINVALID_INDEX) {
+        _parent_pdg_v[index] = larmcp_v[mother_index].part.pdg;
+        _parent_index_v[index] = mother_index;
       }
+    }
+
+    // and the Ancestor info.
+    // (note that for our purposes here, 'ancestor' is the *primary* particle that sits
+    //  at the top of the hierarchy containing this particle.  if this particle is itself primary,
+    //  it's its own ancestor.  if the chain hits a parent missing from the input, there's no ancestor.)
+    // All particles along a chain share the ancestor: each chain is walked once, up to the first
+    // particle already resolved, and the result is handed down to every particle visited on the way.
+    enum { kUnresolved, kOnChain, kResolved };
+    std::vector<unsigned char> state_v(larmcp_v.size(), kUnresolved);
+    std::vector<supera::Index_t> chain;
+    for(size_t index=0; index<larmcp_v.size(); ++index) {
 
-      // Attempt to identify the ancestor
-      auto subject_track_id = mcpart.trackid;
-      auto parent_track_id  = mcpart.parent_trackid;
       auto ancestor_index = supera::kINVALID_INDEX;
       auto ancestor_track_id = supera::kINVALID_TRACKID;
-      while(parent_track_id<_trackid2index.size()) {
-        if(parent_track_id == subject_track_id) {
-          ancestor_index = _trackid2index[subject_track_id];
-          ancestor_track_id = subject_track_id;
+      chain.clear();
+      supera::Index_t subject_index = index;
+      while(true) {
+        if(state_v[subject_index] == kResolved) {
+          ancestor_index = _ancestor_index_v[subject_index];
+          ancestor_track_id = _ancestor_trackid_v[subject_index];
           break;
         }
-        _parent_history_v[index].push_back(parent_track_id);
-        auto const& parent_index = _trackid2index[parent_track_id];
-        if(parent_index == supera::kINVALID_INDEX)
+        if(state_v[subject_index] == kOnChain) {
+          LOG_FATAL() << "Loop in the parentage of track ID " << _trackid_v[index] << "\n";
+          throw supera::meatloaf();
+        }
+        state_v[subject_index] = kOnChain;
+        chain.push_back(subject_index);
+        if(_parent_trackid_v[subject_index] == _trackid_v[subject_index]) {
+          ancestor_index = subject_index;
+          ancestor_track_id = _trackid_v[subject_index];
+          break;
+        }
+        subject_index = _parent_index_v[subject_index];
+        if(subject_index == supera::kINVALID_INDEX)
           break;
-        auto const& parent = larmcp_v[parent_index];
-        subject_track_id = parent.part.trackid;
-        parent_track_id = parent.part.parent_trackid;
       }
       // Set amcestor info
-      _ancestor_index_v[index] = ancestor_index;
-      _ancestor_trackid_v[index] = ancestor_track_id;
-      if(ancestor_index < larmcp_v.size()) 
-        _ancestor_pdg_v[index] = larmcp_v[ancestor_index].part.pdg;
+      for(auto const& chain_index : chain) {
+        state_v[chain_index] = kResolved;
+        _ancestor_index_v[chain_index] = ancestor_index;
+        _ancestor_trackid_v[chain_index] = ancestor_track_id;
+        if(ancestor_index < larmcp_v.size())
+          _ancestor_pdg_v[chain_index] = larmcp_v[ancestor_index].part.pdg;
+      }
     }
   }
 
-  const std::vector< TrackID_t >& 
+  ParentTrackIdRange
   ParticleIndex::ParentTrackIdArray(const TrackID_t trackid) const
   {
-    if(trackid >= _trackid2index.size()) {
-      TrackID_t min_tid, max_tid;
-      for(size_t tid=0; tid<_trackid2index.size(); ++tid) {
-        if(_trackid2index[tid] != supera::kINVALID_INDEX) {
-          min_tid = tid;
-          break;
-        }
-      }
-      for(int tid=(_trackid2index.size()-1); tid >=0; --tid) {
-        if(_trackid2index[tid] != supera::kINVALID_INDEX) {
-          max_tid = tid;
-          break;
-        }
-      }
+    if(trackid >= _trackid_end) {
+      TrackID_t min_tid = _trackid2index.min_trackid();
+      TrackID_t max_tid = _trackid2index.max_trackid();
       LOG_ERROR() << "Track ID " << trackid << " is not valid. "
       << "Registered range " << min_tid << " => " << max_tid 
       << " ... Returning an empty list.\n";
-      return _empty_trackid_v;
+      return ParentTrackIdRange();
     }
-    auto const& index = _trackid2index[trackid];
-    return _parent_history_v[index];
+    return ParentTrackIdRange(this, _trackid2index.find(trackid));
+  }
+
+  // --------------------------------------------
+
+  ParentTrackIdRange::ParentTrackIdRange(const ParticleIndex* mcpl, Index_t index)
+  {
+    if(mcpl && index != kINVALID_INDEX && mcpl->HasParentInChain(index))
+      _begin = const_iterator(mcpl, index);
+  }
+
+  TrackID_t ParentTrackIdRange::back() const
+  {
+    TrackID_t result = kINVALID_TRACKID;
+    for(auto const& trackid : *this) result = trackid;
+    return result;
   }
 
 
@@ -15,9 +15,63 @@
 
 #include "supera/data/Particle.h"
 #include "supera/algorithm/AlgorithmBase.h"
+#include "supera/base/TrackIdMap.h"
+
+#include <iterator>
 
 namespace supera {
     class EventInput;
+    class ParticleIndex;
+
+    /**
+     \class ParentTrackIdRange
+     \brief Ancestry chain of a particle (most recent parent first, up to the primary or the first parent missing
+            from the input), walked lazily along the parent indices of a ParticleIndex.
+    */
+    class ParentTrackIdRange {
+
+    public:
+
+        /// Forward iterator over the parent track IDs: holds the index of the particle whose parent is being visited
+        class const_iterator {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef TrackID_t                 value_type;
+            typedef std::ptrdiff_t            difference_type;
+            typedef const TrackID_t*          pointer;
+            typedef const TrackID_t&          reference;
+
+            const_iterator(const ParticleIndex* mcpl=nullptr, Index_t child=kINVALID_INDEX)
+                : _mcpl(mcpl), _child(child) {}
+
+            inline reference operator*() const;
+            inline const_iterator& operator++();
+            const_iterator operator++(int) { auto result = *this; ++(*this); return result; }
+
+            bool operator==(const const_iterator& rhs) const { return _child == rhs._child; }
+            bool operator!=(const const_iterator& rhs) const { return _child != rhs._child; }
+
+        private:
+            const ParticleIndex* _mcpl;
+            Index_t _child;
+        };
+
+        ParentTrackIdRange(const ParticleIndex* mcpl=nullptr, Index_t index=kINVALID_INDEX);
+
+        const_iterator begin() const { return _begin; }
+        const_iterator end()   const { return const_iterator(); }
+
+        bool empty() const { return _begin == end(); }
+        /// Number of parents in the chain (walks the chain)
+        size_t size() const { return std::distance(begin(), end()); }
+        /// Most recent parent
+        TrackID_t front() const { return *_begin; }
+        /// Most distant parent, i.e. the ancestor if the chain is complete (walks the chain)
+        TrackID_t back() const;
+
+    private:
+        const_iterator _begin;
+    };
 
     /**
      \class ParticleIndex
@@ -28,7 +82,7 @@ namespace supera {
     public:
 
     /// Default constructor
-        ParticleIndex(std::string name="ParticleIndex") : AlgorithmBase(name) {}
+        ParticleIndex(std::string name="ParticleIndex") : AlgorithmBase(name), _trackid_end(0) {}
 
     /// Default destructor
         ~ParticleIndex(){}
@@ -41,10 +95,12 @@ namespace supera {
         const std::vector< Index_t   >& ParentIndex()      const { return _parent_index_v;     }
         const std::vector< TrackID_t >& ParentTrackId()    const { return _parent_trackid_v;   }
         const std::vector< PdgCode_t >& ParentPdgCode()    const { return _parent_pdg_v;       }
-        const std::vector< Index_t   >& TrackIdToIndex()   const { return _trackid2index;      }
+        /// Input index of a track ID (kINVALID_INDEX if unknown), O(1) whatever the track ID range
+        Index_t TrackIdToIndex(const TrackID_t trackid) const { return _trackid2index.find(trackid); }
         const std::vector< Index_t   >& AncestorIndex()    const { return _ancestor_index_v;   }
         const std::vector< TrackID_t >& AncestorTrackId()  const { return _ancestor_trackid_v; }
-        const std::vector< TrackID_t >& ParentTrackIdArray(const TrackID_t) const;
+        /// Ancestry chain of a track ID (most recent parent first), empty for an unknown track ID
+        ParentTrackIdRange ParentTrackIdArray(const TrackID_t) const;
 
     protected:
 
@@ -59,10 +115,28 @@ namespace supera {
         std::vector< Index_t   > _ancestor_index_v;   ///< Ancestor index, index = std::vector<supera::ParticleInput> index
         std::vector< TrackID_t > _ancestor_trackid_v; ///< Ancestor track ID, index = std::vector<supera::ParticleInput> index
         std::vector< PdgCode_t > _ancestor_pdg_v;     ///< Ancestor PDG, index = std::vector<supera::ParticleInput> index
-        std::vector< Index_t   > _trackid2index;      ///< TrackID => std::vector<supera::ParticleInput> index converter
-        std::vector<std::vector< TrackID_t > > _parent_history_v;   ///< TrackID => std::vector<supera::TrackID_t> 
-        std::vector< TrackID_t > _empty_trackid_v;    ///< Empty list of TrackID 
+        TrackIdMap               _trackid2index;      ///< TrackID => std::vector<supera::ParticleInput> index converter
+        TrackID_t                _trackid_end;        ///< track IDs below this are "in range" (max(track ID)+1, at least the number of particles)
+
+        friend class ParentTrackIdRange;
+        /// Does the particle at index have a parent in its ancestry chain? (not a primary, parent track ID in range)
+        bool HasParentInChain(Index_t index) const
+        { return _parent_trackid_v[index] != _trackid_v[index] && _parent_trackid_v[index] < _trackid_end; }
     };
+
+    // --------------------------------------------
+
+    ParentTrackIdRange::const_iterator::reference ParentTrackIdRange::const_iterator::operator*() const
+    { return _mcpl->_parent_trackid_v[_child]; }
+
+    ParentTrackIdRange::const_iterator& ParentTrackIdRange::const_iterator::operator++()
+    {
+        // a parent missing from the input ends the chain (after being listed)
+        _child = _mcpl->_parent_index_v[_child];
+        if(_child != kINVALID_INDEX && !_mcpl->HasParentInChain(_child))
+            _child = kINVALID_INDEX;
+        return *this;
+    }
 }
 
 #endif
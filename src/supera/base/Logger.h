@@ -34,6 +34,7 @@ namespace supera {
     /// Default constructor
     Logger(const std::string& name="no_name")
       : _ostrm(&std::cout)
+      , _level(_level_default)
       , _name(name)
     {}
     
@@ -0,0 +1,108 @@
+#ifndef __SUPERA_RUNSTATS_CXX__
+#define __SUPERA_RUNSTATS_CXX__
+
+#include "RunStats.h"
+#include <iomanip>
+#include <sstream>
+
+namespace supera {
+
+  namespace {
+    const std::string kStageNames[kNumStatStages] = {
+      "ImageMeta", "InferParentage", "InitializeLabels", "MergeShowerTouchingElectron",
+      "ApplyEnergyThreshold", "SetSemanticType", "MergeShowerConversion", "MergeShowerFamilyTouching",
+      "MergeShowerTouching", "MergeShowerTouchingLEScatter", "MergeDeltas", "FillMergedTrackIDs",
+      "RegisterOutputParticles", "SetGroupID", "SetAncestorAttributes", "SetInteractionID",
+      "UnassociatedEDeps", "BuildOutputLabels",
+    };
+
+    const std::string kCounterNames[kNumStatCounters] = {
+      "Events", "IsTouching", "ThresholdVoxels", "EDepOutsideBBox", "UnassociatedOutsideBBox",
+    };
+
+    const std::string kPeakNames[kNumStatPeaks] = {
+      "Labels", "OutputParticles", "Voxels",
+    };
+  }
+
+  const std::string& StatName(StatStage_t stage) { return kStageNames[stage]; }
+  const std::string& StatName(StatCounter_t counter) { return kCounterNames[counter]; }
+  const std::string& StatName(StatPeak_t peak) { return kPeakNames[peak]; }
+
+  void EventStats::clear()
+  {
+    time_ns.fill(0);
+    merges.fill(0);
+    counters.fill(0);
+    peaks.fill(0);
+    stage = kStageImageMeta;
+  }
+
+  void RunStats::reset()
+  {
+    for(auto& v : _time_ns)  v.store(0, std::memory_order_relaxed);
+    for(auto& v : _merges)   v.store(0, std::memory_order_relaxed);
+    for(auto& v : _counters) v.store(0, std::memory_order_relaxed);
+    for(auto& v : _peaks)    v.store(0, std::memory_order_relaxed);
+  }
+
+  void RunStats::record(const EventStats& stats)
+  {
+    for(size_t i=0; i<kNumStatStages; ++i) {
+      if(stats.time_ns[i]) _time_ns[i].fetch_add(stats.time_ns[i], std::memory_order_relaxed);
+      if(stats.merges[i])  _merges[i].fetch_add(stats.merges[i], std::memory_order_relaxed);
+    }
+    for(size_t i=0; i<kNumStatCounters; ++i)
+      if(stats.counters[i]) _counters[i].fetch_add(stats.counters[i], std::memory_order_relaxed);
+    for(size_t i=0; i<kNumStatPeaks; ++i) {
+      auto current = _peaks[i].load(std::memory_order_relaxed);
+      while(stats.peaks[i] > current &&
+            !_peaks[i].compare_exchange_weak(current, stats.peaks[i], std::memory_order_relaxed)) {}
+    }
+  }
+
+  EventStats RunStats::total() const
+  {
+    EventStats result;
+    for(size_t i=0; i<kNumStatStages; ++i) {
+      result.time_ns[i] = _time_ns[i].load(std::memory_order_relaxed);
+      result.merges[i]  = _merges[i].load(std::memory_order_relaxed);
+    }
+    for(size_t i=0; i<kNumStatCounters; ++i) result.counters[i] = _counters[i].load(std::memory_order_relaxed);
+    for(size_t i=0; i<kNumStatPeaks; ++i)    result.peaks[i] = _peaks[i].load(std::memory_order_relaxed);
+    return result;
+  }
+
+  std::map<std::string, double> RunStats::summary() const
+  {
+    auto stats = this->total();
+    std::map<std::string, double> result;
+    for(size_t i=0; i<kNumStatStages; ++i) {
+      result["time_ms/" + kStageNames[i]] = stats.time_ns[i] * 1.e-6;
+      result["merges/" + kStageNames[i]] = stats.merges[i];
+    }
+    for(size_t i=0; i<kNumStatCounters; ++i) result["count/" + kCounterNames[i]] = stats.counters[i];
+    for(size_t i=0; i<kNumStatPeaks; ++i)    result["peak/" + kPeakNames[i]] = stats.peaks[i];
+    return result;
+  }
+
+  std::string RunStats::dump() const
+  {
+    auto stats = this->total();
+    std::stringstream ss;
+    ss << std::setw(30) << std::left << "Stage" << std::setw(14) << std::right << "time [ms]"
+       << std::setw(12) << "merges" << "\n";
+    for(size_t i=0; i<kNumStatStages; ++i)
+      ss << std::setw(30) << std::left << kStageNames[i]
+         << std::setw(14) << std::right << std::fixed << std::setprecision(3) << stats.time_ns[i] * 1.e-6
+         << std::setw(12) << stats.merges[i] << "\n";
+    for(size_t i=0; i<kNumStatCounters; ++i)
+      ss << std::setw(30) << std::left << kCounterNames[i] << std::setw(14) << std::right << stats.counters[i] << "\n";
+    for(size_t i=0; i<kNumStatPeaks; ++i)
+      ss << std::setw(30) << std::left << ("peak " + kPeakNames[i]) << std::setw(14) << std::right << stats.peaks[i] << "\n";
+    return ss.str();
+  }
+
+}
+
+#endif
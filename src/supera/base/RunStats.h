@@ -0,0 +1,159 @@
+/**
+ * \file RunStats.h
+ *
+ * \ingroup base
+ *
+ * \brief Class def header for supera::EventStats, supera::StageTimer and supera::RunStats
+ *
+ */
+
+/** \addtogroup base
+    @{*/
+#ifndef SUPERA_RUNSTATS_H
+#define SUPERA_RUNSTATS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include "Tracer.h"
+
+namespace supera {
+
+  /// Timed stages of the labeling pipeline, in execution order
+  enum StatStage_t {
+    kStageImageMeta,                    ///< BBoxAlgorithm::Generate
+    kStageInferParentage,
+    kStageInitializeLabels,
+    kStageMergeShowerTouchingElectron,
+    kStageApplyEnergyThreshold,
+    kStageSetSemanticType,
+    kStageMergeShowerConversion,
+    kStageMergeShowerFamilyTouching,
+    kStageMergeShowerTouching,
+    kStageMergeShowerTouchingLEScatter,
+    kStageMergeDeltas,
+    kStageFillMergedTrackIDs,
+    kStageRegisterOutputParticles,
+    kStageSetGroupID,
+    kStageSetAncestorAttributes,
+    kStageSetInteractionID,
+    kStageUnassociatedEDeps,
+    kStageBuildOutputLabels,
+    kNumStatStages
+  };
+
+  /// Event counters summed over a run
+  enum StatCounter_t {
+    kCounterEvents,                  ///< events labeled
+    kCounterIsTouching,              ///< voxel-level touching tests between two labels
+    kCounterThresholdVoxels,         ///< voxels dropped by the energy threshold
+    kCounterEDepOutsideBBox,         ///< particle EDeps outside the image or the world bounds
+    kCounterUnassociatedOutsideBBox, ///< unassociated EDeps outside the image
+    kNumStatCounters
+  };
+
+  /// Per-event sizes whose maximum over a run is kept
+  enum StatPeak_t {
+    kPeakLabels,          ///< input particle labels
+    kPeakOutputParticles, ///< particles in the output
+    kPeakVoxels,          ///< voxels in the output energy tensor
+    kNumStatPeaks
+  };
+
+  /// Name of a stage, counter or peak (as used in RunStats::Summary())
+  const std::string& StatName(StatStage_t stage);
+  const std::string& StatName(StatCounter_t counter);
+  const std::string& StatName(StatPeak_t peak);
+
+  /**
+     \class EventStats
+     @brief Plain (single-thread) metrics of one event, flushed into a RunStats once per event.
+  */
+  class EventStats {
+  public:
+    EventStats() { clear(); }
+
+    /// Zero everything
+    void clear();
+
+    /// Add n to a counter
+    inline void count(StatCounter_t counter, uint64_t n=1) { counters[counter] += n; }
+    /// Record a merge in the stage currently running
+    inline void merge() { ++merges[stage]; }
+    /// Keep the larger of the current and the given value of a peak
+    inline void peak(StatPeak_t which, uint64_t value) { if(value > peaks[which]) peaks[which] = value; }
+
+    std::array<uint64_t, kNumStatStages> time_ns;    ///< wall time spent in each stage
+    std::array<uint64_t, kNumStatStages> merges;     ///< label merges done in each stage
+    std::array<uint64_t, kNumStatCounters> counters; ///< event counters
+    std::array<uint64_t, kNumStatPeaks> peaks;       ///< per-event sizes
+    StatStage_t stage;                               ///< stage currently running (set by StageTimer)
+  };
+
+  /**
+     \class StageTimer
+     @brief Scope guard timing one stage into an EventStats with a monotonic clock, \n
+     and into a Tracer as a span named after the stage if one is given.
+  */
+  class StageTimer {
+  public:
+    StageTimer(EventStats& stats, StatStage_t stage, Tracer* tracer=nullptr)
+    : _stats(stats), _span(tracer, StatName(stage).c_str()), _start(std::chrono::steady_clock::now())
+    { _stats.stage = stage; }
+
+    ~StageTimer()
+    {
+      auto elapsed = std::chrono::steady_clock::now() - _start;
+      _stats.time_ns[_stats.stage] += std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    StageTimer(const StageTimer&) = delete;
+    StageTimer& operator=(const StageTimer&) = delete;
+
+  private:
+    EventStats& _stats;
+    TraceSpan _span;
+    std::chrono::steady_clock::time_point _start;
+  };
+
+  /**
+     \class RunStats
+     @brief Metrics accumulated over many events. Record() may be called from several threads at once; \n
+     it costs one relaxed atomic update per metric, once per event.
+  */
+  class RunStats {
+  public:
+    RunStats() { reset(); }
+
+    RunStats(const RunStats&) = delete;
+    RunStats& operator=(const RunStats&) = delete;
+
+    /// Zero everything
+    void reset();
+
+    /// Add one event's metrics (times, merges and counters are summed, peaks maximized)
+    void record(const EventStats& stats);
+
+    /// Snapshot of the current totals
+    EventStats total() const;
+
+    /// Totals by name: "time_ms/<stage>", "merges/<stage>", "count/<counter>" and "peak/<peak>"
+    std::map<std::string, double> summary() const;
+
+    /// Human-readable table of the totals
+    std::string dump() const;
+
+  private:
+    std::array<std::atomic<uint64_t>, kNumStatStages> _time_ns;
+    std::array<std::atomic<uint64_t>, kNumStatStages> _merges;
+    std::array<std::atomic<uint64_t>, kNumStatCounters> _counters;
+    std::array<std::atomic<uint64_t>, kNumStatPeaks> _peaks;
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
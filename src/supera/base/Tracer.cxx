@@ -0,0 +1,111 @@
+#ifndef __SUPERA_TRACER_CXX__
+#define __SUPERA_TRACER_CXX__
+
+#include "Tracer.h"
+#include "meatloaf.h"
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+
+namespace supera {
+
+  namespace {
+
+    std::atomic<uint64_t> gNextTracerID(0);
+
+    /// buffer this thread last recorded into, and the Tracer owning it (ids are never reused,
+    /// so the slot left behind by a destroyed Tracer is never matched again)
+    struct ThreadSlot_t {
+      uint64_t tracer_id;
+      void* buffer;
+    };
+    thread_local ThreadSlot_t tlSlot = {UINT64_MAX, nullptr};
+    thread_local int64_t tlEvent = -1;
+
+    void WriteArg(std::ostream& out, bool& first, const char* key, int64_t value)
+    {
+      if(value < 0) return;
+      out << (first ? "" : ",") << "\"" << key << "\":" << value;
+      first = false;
+    }
+  }
+
+  Tracer::Tracer()
+  : _id(gNextTracerID++)
+  , _start(std::chrono::steady_clock::now())
+  {}
+
+  double Tracer::Now() const
+  {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _start).count();
+  }
+
+  void Tracer::SetCurrentEvent(int64_t event) { tlEvent = event; }
+
+  int64_t Tracer::CurrentEvent() { return tlEvent; }
+
+  Tracer::Buffer_t& Tracer::LocalBuffer()
+  {
+    if(tlSlot.tracer_id == _id) return *static_cast<Buffer_t*>(tlSlot.buffer);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    auto& buffer = _thread_buffers[std::this_thread::get_id()];
+    if(!buffer) {
+      _buffers.emplace_back(new Buffer_t);
+      buffer = _buffers.back().get();
+      buffer->tid = _buffers.size() - 1;
+    }
+    tlSlot = ThreadSlot_t{_id, buffer};
+    return *buffer;
+  }
+
+  void Tracer::Record(const Span_t& span)
+  {
+    this->LocalBuffer().spans.push_back(span);
+  }
+
+  void Tracer::Clear()
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    for(auto& buffer : _buffers) buffer->spans.clear();
+  }
+
+  size_t Tracer::NumSpans() const
+  {
+    std::lock_guard<std::mutex> lock(_mtx);
+    size_t result = 0;
+    for(auto const& buffer : _buffers) result += buffer->spans.size();
+    return result;
+  }
+
+  void Tracer::Write(const std::string& file_name) const
+  {
+    std::ofstream out(file_name);
+    if(!out) throw meatloaf("Tracer: cannot open " + file_name);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first_event = true;
+    for(auto const& buffer : _buffers) {
+      out << (first_event ? "" : ",\n")
+          << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->tid
+          << ",\"args\":{\"name\":\"supera-" << buffer->tid << "\"}}";
+      first_event = false;
+      for(auto const& span : buffer->spans) {
+        out << ",\n{\"name\":\"" << span.name << "\",\"cat\":\"supera\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid
+            << ",\"ts\":" << span.ts << ",\"dur\":" << span.dur << ",\"args\":{";
+        bool first_arg = true;
+        WriteArg(out, first_arg, "event", span.event);
+        WriteArg(out, first_arg, "particles", span.particles);
+        WriteArg(out, first_arg, "voxels", span.voxels);
+        out << "}}";
+      }
+    }
+    out << "\n]}\n";
+    if(!out) throw meatloaf("Tracer: failed writing " + file_name);
+  }
+
+}
+
+#endif
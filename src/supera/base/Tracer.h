@@ -0,0 +1,127 @@
+/**
+ * \file Tracer.h
+ *
+ * \ingroup base
+ *
+ * \brief Class def header for supera::Tracer and supera::TraceSpan
+ *
+ */
+
+/** \addtogroup base
+    @{*/
+#ifndef SUPERA_TRACER_H
+#define SUPERA_TRACER_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace supera {
+
+  /**
+     \class Tracer
+     @brief Records begin/end spans of the labeling pipeline and writes them as a Chrome trace-event JSON file \n
+     (viewable in chrome://tracing or ui.perfetto.dev). \n
+     Every thread appends to its own buffer (one per thread id, so persistent pool threads keep their tid) without \n
+     locking: a thread caches the last Tracer it recorded into, and takes the lock only when it switches Tracer. \n
+     Write() and Clear() must not run while spans are being recorded.
+  */
+  class Tracer {
+  public:
+    /// One finished span
+    struct Span_t {
+      const char* name; ///< must outlive the Tracer (string literal or static storage)
+      double ts;        ///< start [us] since the Tracer was created
+      double dur;       ///< duration [us]
+      int64_t event;    ///< event index, -1 if unknown
+      int64_t particles;///< input particles, -1 if not set
+      int64_t voxels;   ///< output voxels, -1 if not set
+    };
+
+    Tracer();
+    ~Tracer() = default;
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    /// Time since the Tracer was created [us]
+    double Now() const;
+
+    /// Append a finished span to the calling thread's buffer
+    void Record(const Span_t& span);
+
+    /// Drop all recorded spans
+    void Clear();
+
+    /// Number of recorded spans
+    size_t NumSpans() const;
+
+    /// Write all recorded spans to a Chrome trace-event JSON file
+    void Write(const std::string& file_name) const;
+
+    /// Event index that spans recorded by the calling thread are tagged with (-1 = none)
+    static void SetCurrentEvent(int64_t event);
+    static int64_t CurrentEvent();
+
+  private:
+    /// Spans of one thread (tid = position in _buffers)
+    struct Buffer_t {
+      size_t tid;
+      std::vector<Span_t> spans;
+    };
+
+    /// The calling thread's buffer, registered on first use
+    Buffer_t& LocalBuffer();
+
+    uint64_t _id; ///< unique across all Tracers ever created, validates the per-thread cached buffer
+    std::chrono::steady_clock::time_point _start;
+    mutable std::mutex _mtx; ///< guards _buffers and _thread_buffers (not the spans inside them)
+    std::vector<std::unique_ptr<Buffer_t> > _buffers;
+    std::map<std::thread::id, Buffer_t*> _thread_buffers; ///< buffer of every thread that recorded a span
+  };
+
+  /**
+     \class TraceSpan
+     @brief Scope guard recording one span into a Tracer (does nothing if the Tracer is nullptr). \n
+     The span is tagged with the thread's current event when it ends.
+  */
+  class TraceSpan {
+  public:
+    TraceSpan(Tracer* tracer, const char* name, int64_t particles=-1)
+    : _tracer(tracer)
+    {
+      if(!_tracer) return;
+      _span.name = name;
+      _span.ts = _tracer->Now();
+      _span.particles = particles;
+      _span.voxels = -1;
+    }
+
+    ~TraceSpan()
+    {
+      if(!_tracer) return;
+      _span.dur = _tracer->Now() - _span.ts;
+      _span.event = Tracer::CurrentEvent();
+      _tracer->Record(_span);
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    /// Tag the span with the number of output voxels
+    void SetVoxels(int64_t voxels) { _span.voxels = voxels; }
+
+  private:
+    Tracer* _tracer;
+    Tracer::Span_t _span;
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
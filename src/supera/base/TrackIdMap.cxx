@@ -0,0 +1,85 @@
+#ifndef __SUPERA_TRACKIDMAP_CXX__
+#define __SUPERA_TRACKIDMAP_CXX__
+
+#include "TrackIdMap.h"
+#include <algorithm>
+
+namespace supera {
+
+  namespace {
+    /// Dense tables up to this many entries are always allowed (cheap, and the common case for small events)
+    const size_t kMinDenseSize = 4096;
+
+    /// Shrink a buffer that became much larger than needed, otherwise resize it in place
+    template <class T>
+    void Fit(std::vector<T>& buffer, size_t size, const T& value)
+    {
+      if(buffer.capacity() > std::max(4 * size, kMinDenseSize))
+        std::vector<T>().swap(buffer);
+      buffer.assign(size, value);
+    }
+  }
+
+  void TrackIdMap::clear()
+  {
+    _dense = true;
+    _size = 0;
+    _min_trackid = _max_trackid = kINVALID_TRACKID;
+    _dense_v.clear();
+    _slot_v.clear();
+    _mask = 0;
+    _shift = 64;
+  }
+
+  void TrackIdMap::assign(const std::vector<TrackID_t>& trackid_v)
+  {
+    clear();
+    if(trackid_v.empty()) {
+      Fit(_dense_v, 0, kINVALID_INDEX);
+      Fit(_slot_v, 0, Slot_t{kINVALID_TRACKID, kINVALID_INDEX});
+      return;
+    }
+    _min_trackid = *std::min_element(trackid_v.begin(), trackid_v.end());
+    _max_trackid = *std::max_element(trackid_v.begin(), trackid_v.end());
+
+    _dense = _max_trackid < std::max(_dense_factor * trackid_v.size(), kMinDenseSize);
+    if(_dense) {
+      Fit(_slot_v, 0, Slot_t{kINVALID_TRACKID, kINVALID_INDEX});
+      Fit(_dense_v, _max_trackid + 1, kINVALID_INDEX);
+      for(size_t index = 0; index < trackid_v.size(); ++index) {
+        auto& entry = _dense_v[trackid_v[index]];
+        if(entry == kINVALID_INDEX) ++_size;
+        entry = index;
+      }
+      return;
+    }
+
+    // hash table at most half full
+    size_t num_slots = 2;
+    _shift = 63;
+    while(num_slots < 2 * trackid_v.size()) {
+      num_slots *= 2;
+      --_shift;
+    }
+    _mask = num_slots - 1;
+    Fit(_dense_v, 0, kINVALID_INDEX);
+    Fit(_slot_v, num_slots, Slot_t{kINVALID_TRACKID, kINVALID_INDEX});
+    for(size_t index = 0; index < trackid_v.size(); ++index) {
+      auto const& trackid = trackid_v[index];
+      size_t s = slot(trackid);
+      while(_slot_v[s].trackid != kINVALID_TRACKID && _slot_v[s].trackid != trackid)
+        s = (s + 1) & _mask;
+      if(_slot_v[s].trackid == kINVALID_TRACKID) ++_size;
+      _slot_v[s].trackid = trackid;
+      _slot_v[s].index = index;
+    }
+  }
+
+  size_t TrackIdMap::memory() const
+  {
+    return _dense_v.capacity() * sizeof(Index_t) + _slot_v.capacity() * sizeof(Slot_t);
+  }
+
+}
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ * \file TrackIdMap.h
+ *
+ * \ingroup base
+ *
+ * \brief Class def header for a class supera::TrackIdMap
+ *
+ */
+
+/** \addtogroup base
+    @{*/
+#ifndef SUPERA_TRACKIDMAP_H
+#define SUPERA_TRACKIDMAP_H
+
+#include <cstddef>
+#include <vector>
+
+#include "SuperaType.h"
+
+namespace supera {
+
+  /**
+     \class TrackIdMap
+     @brief Track ID => particle index map of an event, with O(1) lookups and memory bounded by the number of particles. \n
+     While the track IDs are compact (largest one below dense_factor times the number of particles, or a small floor)
+     a plain table indexed by track ID is used. Otherwise (e.g. 1e8 track ID offsets of overlaid interactions)
+     the map switches to an open-addressing hash table with linear probing, at most half full.
+     Buffers are reused across events, but released once they are far larger than the current event needs.
+  */
+  class TrackIdMap {
+  public:
+    /// Default ctor
+    TrackIdMap(size_t dense_factor = 4) : _dense_factor(dense_factor) { clear(); }
+    /// Default dtor
+    ~TrackIdMap() = default;
+
+    /// Forget all entries (keeps the buffers)
+    void clear();
+    /// Rebuild the map: trackid_v[index] => index (for a repeated track ID, the last index wins)
+    void assign(const std::vector<TrackID_t>& trackid_v);
+
+    /// Index of a track ID, kINVALID_INDEX if not registered
+    inline Index_t find(TrackID_t trackid) const;
+
+    /// Number of registered track IDs
+    inline size_t size() const { return _size; }
+    /// True if the dense table is in use
+    inline bool dense() const { return _dense; }
+    /// Smallest registered track ID (kINVALID_TRACKID if empty)
+    inline TrackID_t min_trackid() const { return _min_trackid; }
+    /// Largest registered track ID (kINVALID_TRACKID if empty)
+    inline TrackID_t max_trackid() const { return _max_trackid; }
+    /// Bytes currently held by the buffers
+    size_t memory() const;
+
+  private:
+    struct Slot_t {
+      TrackID_t trackid;
+      Index_t   index;
+    };
+
+    inline size_t slot(TrackID_t trackid) const
+    { return (size_t)((trackid * 0x9E3779B97F4A7C15ull) >> _shift); }
+
+    size_t _dense_factor;
+    bool   _dense;
+    size_t _size;
+    TrackID_t _min_trackid;
+    TrackID_t _max_trackid;
+    std::vector<Index_t> _dense_v;  ///< dense table: track ID => index
+    std::vector<Slot_t>  _slot_v;   ///< hash table (size is a power of 2)
+    size_t _mask;                   ///< _slot_v.size() - 1
+    unsigned int _shift;            ///< 64 - log2(_slot_v.size())
+  };
+
+  Index_t TrackIdMap::find(TrackID_t trackid) const
+  {
+    if(_dense)
+      return trackid < _dense_v.size() ? _dense_v[trackid] : kINVALID_INDEX;
+    if(_slot_v.empty()) return kINVALID_INDEX;
+    // empty slots hold kINVALID_TRACKID & kINVALID_INDEX, and the table is never full
+    for(size_t s = slot(trackid); ; s = (s + 1) & _mask) {
+      auto const& entry = _slot_v[s];
+      if(entry.trackid == trackid || entry.trackid == kINVALID_TRACKID)
+        return entry.index;
+    }
+  }
+
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -2,9 +2,12 @@
 #define __SUPERA_VOXEL_CXX__
 
 #include "Voxel.h"
+#include "VoxelKernel.h"
 #include <iostream>
 #include <cmath>
 #include <sstream>
+#include <algorithm>
+#include <limits>
 
 namespace supera {
 
@@ -21,164 +24,242 @@ namespace supera {
     return ss.str();
   }
 
-  float VoxelSet::max() const
+  std::vector<supera::Voxel> VoxelSet::as_vector() const
   {
-    float val = kINVALID_FLOAT;
-    for(auto const& vox : _voxel_v) {
-      if(vox.value() > val) val = vox.value();
-    }
-    return val;
+    std::vector<supera::Voxel> res;
+    res.reserve(_id_v.size());
+    for(size_t i=0; i<_id_v.size(); ++i)
+      res.emplace_back(_id_v[i],_value_v[i]);
+    return res;
   }
 
-  void VoxelSet::clear_invalid(bool clear_invalid_float, bool clear_nan, bool clear_inf)
+  float VoxelSet::sum() const
   {
-    if(!clear_invalid_float && !clear_nan && !clear_inf) return;
-    std::vector<supera::Voxel> vox_v;
-    vox_v.reserve(_voxel_v.size());
-    for(auto const& vox : _voxel_v) {
-      if (clear_inf && std::isinf(vox.value())) continue;
-      if (clear_nan && std::isnan(vox.value())) continue;
-      if (clear_invalid_float && vox.value() == supera::kINVALID_FLOAT) continue;
-      vox_v.push_back(vox);
-    }
-    _voxel_v = std::move(vox_v);
+    return simd::Sum(_value_v.data(), _value_v.size());
   }
 
+  float VoxelSet::max() const
+  {
+    if(_value_v.empty()) return kINVALID_FLOAT;
+    return simd::Max(_value_v.data(), _value_v.size(), std::numeric_limits<float>::lowest());
+  }
 
   float VoxelSet::min() const
   {
-    float val = kINVALID_FLOAT;
-    for(auto const& vox : _voxel_v) {
-      if(vox.value() < val) val = vox.value();
-    }
-    return val;
+    if(_value_v.empty()) return kINVALID_FLOAT;
+    return simd::Min(_value_v.data(), _value_v.size(), std::numeric_limits<float>::max());
   }
 
-  void VoxelSet::threshold(float min, float max)
+  void VoxelSet::compact(float min, float max, bool clear_invalid_float, bool clear_nan, bool clear_inf)
   {
-    std::vector<supera::Voxel> vox_v;
-    vox_v.reserve(_voxel_v.size());
-    for(auto const& vox : _voxel_v) {
-      if(vox.value() < min || vox.value() > max) continue;
-      vox_v.push_back(vox);
-    }
-    _voxel_v = std::move(vox_v);
+    const simd::Cut_t cut = {min, max, clear_nan, clear_inf, clear_invalid_float};
+    size_t num = simd::Compact(_id_v.data(), _value_v.data(), _id_v.size(), cut);
+    _id_v.resize(num);
+    _value_v.resize(num);
   }
 
-  void VoxelSet::threshold_min(float min)
+  void VoxelSet::clear_invalid(bool clear_invalid_float, bool clear_nan, bool clear_inf)
   {
-    std::vector<supera::Voxel> vox_v;
-    vox_v.reserve(_voxel_v.size());
-    for(auto const& vox : _voxel_v) {
-      if(vox.value() < min) continue;
-      vox_v.push_back(vox);
-    }
-    _voxel_v = std::move(vox_v);
+    if(!clear_invalid_float && !clear_nan && !clear_inf) return;
+    compact(-std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
+      clear_invalid_float, clear_nan, clear_inf);
   }
 
+  void VoxelSet::threshold(float min, float max)
+  { compact(min, max, false, false, false); }
+
+  void VoxelSet::threshold_min(float min)
+  { compact(min, std::numeric_limits<float>::infinity(), false, false, false); }
+
   void VoxelSet::threshold_max(float max)
-  {
-    std::vector<supera::Voxel> vox_v;
-    vox_v.reserve(_voxel_v.size());
-    for(auto const& vox : _voxel_v) {
-      if(vox.value() > max) continue;
-      vox_v.push_back(vox);
-    }
-    _voxel_v = std::move(vox_v);
-  }
+  { compact(-std::numeric_limits<float>::infinity(), max, false, false, false); }
 
   void VoxelSet::add(const Voxel& vox)
   {
-    Voxel copy(vox);
-    emplace(std::move(copy),true);
+    emplace(vox.id(),vox.value(),true);
   }
 
   void VoxelSet::insert(const Voxel& vox)
   {
-    Voxel copy(vox);
-    emplace(std::move(copy),false);
+    emplace(vox.id(),vox.value(),false);
   }
 
-  const Voxel& VoxelSet::find(VoxelID_t id) const
+  Voxel VoxelSet::find(VoxelID_t id) const
   {
-    if(_voxel_v.empty() ||
-     id < _voxel_v.front().id() ||
-     id > _voxel_v.back().id())
-      return kINVALID_VOXEL;
-
-    Voxel vox(id,0.);
-    // Else do log(N) search
-    auto iter = std::lower_bound(_voxel_v.begin(), _voxel_v.end(), vox);
-    if( (*iter).id() == id ) return (*iter);
-    else {
-      //std::cout << "Returning invalid voxel since lower_bound had an id " << (*iter).id() << std::endl;
-      return kINVALID_VOXEL;
-    }
+    auto idx = index(id);
+    if(idx == kINVALID_SIZE) return kINVALID_VOXEL;
+    return Voxel(_id_v[idx],_value_v[idx]);
   }
 
   size_t VoxelSet::index(VoxelID_t id) const
   {
-    if(_voxel_v.empty() ||
-     id < _voxel_v.front().id() ||
-     id > _voxel_v.back().id())
+    if(_id_v.empty() ||
+     id < _id_v.front() ||
+     id > _id_v.back())
       return kINVALID_SIZE;
 
-    Voxel vox(id,0.);
     // Else do log(N) search
-    auto iter = std::lower_bound(_voxel_v.begin(), _voxel_v.end(), vox);
-    if( (*iter).id() == id ) return (iter - _voxel_v.begin());
+    auto iter = std::lower_bound(_id_v.begin(), _id_v.end(), id);
+    if( (*iter) == id ) return (iter - _id_v.begin());
     else {
-      //std::cout << "Returning invalid voxel since lower_bound had an id " << (*iter).id() << std::endl;
       return kINVALID_SIZE;
     }
   }
 
-  void VoxelSet::emplace(Voxel&& vox, const bool add)
+  void VoxelSet::assign(const VoxelID_t* ids, const float* values, size_t num)
   {
-    // In case it's empty or greater than the last one
-    if (_voxel_v.empty() || _voxel_v.back() < vox) {
-      _voxel_v.emplace_back(std::move(vox));
-      return;
+    for(size_t i=1; i<num; ++i) {
+      if(ids[i-1] >= ids[i])
+        throw meatloaf("VoxelSet::assign voxel ids must be sorted and unique");
+    }
+    _id_v.assign(ids, ids + num);
+    _value_v.assign(values, values + num);
+    _staged = false;
+  }
+
+  void VoxelSet::finalize(const bool add)
+  {
+    if(!_staged) return;
+    _staged = false;
+    if(_id_v.empty()) return;
+
+    // Stable sort keeps the staging order among duplicates, so the reduction
+    // below gives the same result as calling emplace one voxel at a time.
+    if(!std::is_sorted(_id_v.begin(), _id_v.end())) {
+      std::vector<size_t> order(_id_v.size());
+      for(size_t i=0; i<order.size(); ++i) order[i] = i;
+      std::stable_sort(order.begin(), order.end(),
+        [this](size_t a, size_t b) { return _id_v[a] < _id_v[b]; });
+      std::vector<supera::VoxelID_t> id_v(_id_v.size());
+      std::vector<float> value_v(_value_v.size());
+      for(size_t i=0; i<order.size(); ++i) {
+        id_v[i] = _id_v[order[i]];
+        value_v[i] = _value_v[order[i]];
+      }
+      _id_v = std::move(id_v);
+      _value_v = std::move(value_v);
     }
-    // In case it's smaller than the first one
-    if (_voxel_v.front() > vox) {
-      _voxel_v.emplace_back(std::move(vox));
-      for (size_t idx = 0; (idx + 1) < _voxel_v.size(); ++idx) {
-        auto& element1 = _voxel_v[ _voxel_v.size() - (idx + 1) ];
-        auto& element2 = _voxel_v[ _voxel_v.size() - (idx + 2) ];
-        std::swap( element1, element2 );
+
+    // Reduce duplicates in place
+    size_t last = 0;
+    for(size_t idx = 1; idx < _id_v.size(); ++idx) {
+      if(_id_v[idx] == _id_v[last]) {
+        if(add) _value_v[last] += _value_v[idx];
+        else _value_v[last] = _value_v[idx];
+        continue;
+      }
+      ++last;
+      if(last != idx) {
+        _id_v[last] = _id_v[idx];
+        _value_v[last] = _value_v[idx];
       }
+    }
+    _id_v.resize(last+1);
+    _value_v.resize(last+1);
+  }
+
+  void VoxelSet::emplace(VoxelID_t id, float value, const bool add)
+  {
+    if(_staged) {
+      std::cerr << "VoxelSet::emplace called while staged voxels are not finalized!" << std::endl;
+      throw std::exception();
+    }
+    // In case it's empty or greater than the last one
+    if (_id_v.empty() || _id_v.back() < id) {
+      _id_v.push_back(id);
+      _value_v.push_back(value);
       return;
     }
 
     // Else do log(N) search
-    auto iter = std::lower_bound(_voxel_v.begin(), _voxel_v.end(), vox);
+    auto iter = std::lower_bound(_id_v.begin(), _id_v.end(), id);
 
     // Cannot be the end
-    if ( iter == _voxel_v.end() ) {
+    if ( iter == _id_v.end() ) {
       std::cerr << "VoxelSet sorting logic error!" << std::endl;
       throw std::exception();
     }
 
+    size_t idx = iter - _id_v.begin();
     // If found, merge
-    if ( vox.id() == (*iter).id() ) {
-      if(add) (*iter) += vox.value();
-      else (*iter).set(vox.id(),vox.value());
-      return;
+    if ( id == (*iter) ) {
+      if(add) _value_v[idx] += value;
+      else _value_v[idx] = value;
     }
     // Else insert @ appropriate place
     else {
-      size_t target_ctr = _voxel_v.size() - (iter - _voxel_v.begin());
-      _voxel_v.emplace_back(std::move(vox));
-      for (size_t idx = 0; idx < target_ctr; ++idx) {
-        auto& element1 = _voxel_v[ _voxel_v.size() - (idx + 1) ];
-        auto& element2 = _voxel_v[ _voxel_v.size() - (idx + 2) ];
-        std::swap( element1, element2 );
-      }
+      _id_v.insert(iter, id);
+      _value_v.insert(_value_v.begin() + idx, value);
     }
     return;
   }
 
+  void VoxelSet::emplace(const VoxelSet& vs, const bool add)
+  {
+    if(_staged || vs._staged) {
+      std::cerr << "VoxelSet::emplace called while staged voxels are not finalized!" << std::endl;
+      throw std::exception();
+    }
+    auto const& other_id_v = vs._id_v;
+    auto const& other_value_v = vs._value_v;
+    if(other_id_v.empty()) return;
+
+    // In case it's empty or entirely after the last one
+    if(_id_v.empty() || _id_v.back() < other_id_v.front()) {
+      _id_v.insert(_id_v.end(), other_id_v.begin(), other_id_v.end());
+      _value_v.insert(_value_v.end(), other_value_v.begin(), other_value_v.end());
+      return;
+    }
+
+    // Count the overlapping IDs to get the merged size
+    size_t overlap = 0;
+    size_t i = 0, j = 0;
+    while(i < _id_v.size() && j < other_id_v.size()) {
+      if(_id_v[i] < other_id_v[j]) ++i;
+      else if(other_id_v[j] < _id_v[i]) ++j;
+      else { ++overlap; ++i; ++j; }
+    }
+
+    // Merge from the back so the existing buffers can be reused in place
+    size_t orig_size = _id_v.size();
+    _id_v.resize(orig_size + other_id_v.size() - overlap);
+    _value_v.resize(_id_v.size());
+    size_t k = _id_v.size();
+    i = orig_size;
+    j = other_id_v.size();
+    while(j > 0) {
+      --k;
+      if(i > 0 && other_id_v[j-1] < _id_v[i-1]) {
+        --i;
+        _id_v[k] = _id_v[i];
+        _value_v[k] = _value_v[i];
+      }
+      else if(i > 0 && other_id_v[j-1] == _id_v[i-1]) {
+        --i; --j;
+        _id_v[k] = _id_v[i];
+        _value_v[k] = (add ? _value_v[i] + other_value_v[j] : other_value_v[j]);
+      }
+      else {
+        --j;
+        _id_v[k] = other_id_v[j];
+        _value_v[k] = other_value_v[j];
+      }
+    }
+    // Remaining elements [0,i) are already in place (k == i)
+  }
+
+  void VoxelSet::emplace(VoxelSet&& vs, const bool add)
+  {
+    if(_id_v.empty() && !_staged && !vs._staged) {
+      _id_v = std::move(vs._id_v);
+      _value_v = std::move(vs._value_v);
+      vs.clear_data();
+      return;
+    }
+    emplace((const VoxelSet&)(vs), add);
+    vs.clear_data();
+  }
+
   bool VoxelSet::operator==(const VoxelSet &rhs) const
   {
     // obviously not the same if they're not the same size
@@ -186,12 +267,7 @@ namespace supera {
       return false;
 
     // because VoxelSets are sorted by nature, we can just compare them element by element
-    for (std::size_t idx = 0; idx < size(); idx++)
-    {
-      if (_voxel_v[idx] != rhs._voxel_v[idx])
-        return false;
-    }
-    return true;
+    return _id_v == rhs._id_v;
   }
 
   std::string VoxelSet::dump2cpp(const std::string &instanceName) const
@@ -204,10 +280,10 @@ namespace supera {
       ss << "ul";
     ss << ");\n";
 
-    ss << instanceName << ".reserve(" << _voxel_v.size() << ");\n";
-    for (std::size_t idx = 0; idx < _voxel_v.size(); idx++)
+    ss << instanceName << ".reserve(" << _id_v.size() << ");\n";
+    for (std::size_t idx = 0; idx < _id_v.size(); idx++)
     {
-      const supera::Voxel & vox = _voxel_v[idx];
+      const supera::Voxel vox(_id_v[idx],_value_v[idx]);
       std::string voxInstance = instanceName + "_vox" + std::to_string(idx);
       ss << vox.dump2cpp(voxInstance);
       ss << instanceName << ".emplace(std::move(" << voxInstance << "), false);\n";
@@ -220,12 +296,8 @@ namespace supera {
   void VoxelSet::fill_std_vectors(std::vector<unsigned long>& id_v,
     std::vector<float>& value_v) const
   {
-    id_v.resize(this->size());
-    value_v.resize(this->size());
-    for(size_t i=0; i<this->size(); ++i) {
-      id_v[i]=_voxel_v[i].id();
-      value_v[i]=_voxel_v[i].value();
-    }
+    id_v.assign(_id_v.begin(), _id_v.end());
+    value_v.assign(_value_v.begin(), _value_v.end());
   }
 
 
@@ -244,24 +316,26 @@ namespace supera {
 
   float VoxelSetArray::max() const
   {
-    float val = std::numeric_limits<float>::min();
-    float ival = 0.;
+    float val = std::numeric_limits<float>::lowest();
+    bool empty = true;
     for(auto const& vox_v : _voxel_vv) {
-      ival = vox_v.max();
-      val = (val < ival ? ival : val);
+      if(!vox_v.size()) continue;
+      val = simd::Max(vox_v.values().data(), vox_v.size(), val);
+      empty = false;
     }
-    return val;
+    return (empty ? kINVALID_FLOAT : val);
   }
 
   float VoxelSetArray::min() const
   {
     float val = std::numeric_limits<float>::max();
-    float ival = 0.;
+    bool empty = true;
     for(auto const& vox_v : _voxel_vv) {
-      ival = vox_v.min();
-      val = (val > ival ? ival : val);
+      if(!vox_v.size()) continue;
+      val = simd::Min(vox_v.values().data(), vox_v.size(), val);
+      empty = false;
     }
-    return val;
+    return (empty ? kINVALID_FLOAT : val);
   }
 
   const supera::VoxelSet& VoxelSetArray::voxel_set(InstanceID_t id) const
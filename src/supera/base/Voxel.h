@@ -15,6 +15,7 @@
 
 #include "SuperaType.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -96,18 +97,20 @@ namespace supera {
 
   /**
      \class VoxelSet
-     @brief Container of multiple voxels consisting of ordered sparse vector and meta data
+     @brief Container of multiple voxels consisting of ordered sparse vector and meta data. \n
+     Voxels are stored as a structure-of-arrays: a sorted array of VoxelID_t and a parallel array of values. \n
+     Both arrays are contiguous and can be exported (e.g. to numpy) without copying.
    */
   class VoxelSet {
   public:
     /// Default ctor
-    VoxelSet() : _id(supera::kINVALID_INSTANCEID) {}
+    VoxelSet() : _id(supera::kINVALID_INSTANCEID), _staged(false) {}
 
     /// Copy constructor
     VoxelSet(const VoxelSet & rhs) = default;
 
       /// Move constructor
-    VoxelSet(VoxelSet && rhs) = default;  //{ _id = rhs._id; _voxel_v = std::move(rhs._voxel_v); return *this; }
+    VoxelSet(VoxelSet && rhs) = default;
 
     /// Default dtor
     virtual ~VoxelSet() = default;
@@ -117,32 +120,40 @@ namespace supera {
     //
     /// InstanceID_t getter
     inline InstanceID_t id() const { return _id; }
-    /// Access as a raw vector
-    inline const std::vector<supera::Voxel>& as_vector() const { return _voxel_v; }
-    /// Returns a const reference to a voxel with specified id. if not present, invalid voxel is returned.
-    const Voxel& find(VoxelID_t id) const;
+    /// Sorted array of voxel IDs (contiguous, parallel to VoxelSet::values).
+    /// In python this is a read-only numpy view, invalid after any change to the VoxelSet.
+    inline const std::vector<supera::VoxelID_t>& ids() const { return _id_v; }
+    /// Array of voxel values (contiguous, parallel to VoxelSet::ids).
+    /// In python this is a read-only numpy view, invalid after any change to the VoxelSet.
+    inline const std::vector<float>& values() const { return _value_v; }
+    /// Voxel at the specified index of the storage arrays
+    inline Voxel voxel(size_t index) const { return Voxel(_id_v[index],_value_v[index]); }
+    /// Access as a vector of Voxel (this builds a copy: prefer VoxelSet::ids and VoxelSet::values)
+    std::vector<supera::Voxel> as_vector() const;
+    /// Returns a voxel with specified id. if not present, invalid voxel is returned.
+    Voxel find(VoxelID_t id) const;
     /// Returns the index of specified voxel id in the storage array
     size_t index(VoxelID_t id) const;
-    /// Sum of contained voxel values
-    inline float sum() const { float res=0.; for(auto const& vox : _voxel_v) res+=vox.value(); return res;}
+    /// Sum of contained voxel values (summation order and rounding as in simd::Sum)
+    float sum() const;
     /// Mean of contained voxel values
-    inline float mean() const { return (_voxel_v.empty() ? 0. : sum() / (float)(_voxel_v.size())); }
-    /// Max of contained voxel values
+    inline float mean() const { return (_value_v.empty() ? 0. : sum() / (float)(_value_v.size())); }
+    /// Max of contained voxel values (kINVALID_FLOAT if empty)
     float max() const;
-    /// Min of contained voxel values
+    /// Min of contained voxel values (kINVALID_FLOAT if empty)
     float min() const;
     /// Size (count) of voxels
-    inline size_t size() const { return _voxel_v.size(); }
+    inline size_t size() const { return _id_v.size(); }
 
     //
     // Write-access
     //
     /// Clear everything
-    inline virtual void clear_data() { _voxel_v.clear(); }
+    inline virtual void clear_data() { _id_v.clear(); _value_v.clear(); _staged = false; }
     /// Clear "invalid" values
     void clear_invalid(bool clear_invalid_float=true, bool clear_nan=true, bool clear_inf=true);
     /// Reserve
-    inline void reserve(size_t num) { _voxel_v.reserve(num); }
+    inline void reserve(size_t num) { _id_v.reserve(num); _value_v.reserve(num); }
     /// Thresholding voxels by an upper and lower end values
     void threshold(float min, float max);
     /// Thresholding by only lower end value
@@ -155,16 +166,26 @@ namespace supera {
     /// Set a voxel. If another voxel instance w/ same VoxelID exists, value is set
     void insert(const Voxel& vox);
     /// Emplace a new voxel. Same logic as VoxelSet::add but consumes removable reference.
-    void emplace(Voxel&& vox, const bool add);
+    inline void emplace(Voxel&& vox, const bool add)
+    { emplace(vox.id(),vox.value(),add); }
     /// Paint by a single value
     inline void paint(float value)
-    { for(auto& vox : _voxel_v) vox.set(vox.id(), value); }
+    { std::fill(_value_v.begin(),_value_v.end(),value); }
     /// Emplace a new voxel from id & value
-    inline void emplace(VoxelID_t id, float value, const bool add)
-    { emplace(Voxel(id,value),add); }
-    /// Merge a set of voxels
-    inline void emplace(const VoxelSet& vs, const bool add)
-    { for(auto const& v : vs.as_vector()) emplace(v.id(),v.value(),add); }
+    void emplace(VoxelID_t id, float value, const bool add);
+    /// Merge a set of voxels (single linear pass over both sorted sets)
+    void emplace(const VoxelSet& vs, const bool add);
+    /// Merge a set of voxels. Same logic as above but takes over the storage of vs if this set is empty.
+    void emplace(VoxelSet&& vs, const bool add);
+    /// Append a voxel without keeping the order (bulk-build). VoxelSet::finalize must be called before any other access.
+    inline void stage(VoxelID_t id, float value)
+    { _id_v.push_back(id); _value_v.push_back(value); _staged = true; }
+    /// Sort staged voxels and reduce duplicate IDs (values are summed if add is true, else the last staged value is kept)
+    void finalize(const bool add);
+    /// Replace the contents by num voxels whose ids are already sorted and unique (e.g. read back from a file)
+    void assign(const VoxelID_t* ids, const float* values, size_t num);
+    /// True if there are staged voxels waiting for VoxelSet::finalize
+    inline bool staged() const { return _staged; }
     /// InstanceID_t setter
     inline void id(const InstanceID_t id) { _id = id; }
 
@@ -176,19 +197,20 @@ namespace supera {
     // Binary operations
     //
     inline VoxelSet& operator += (float value)
-    { for(auto& vox : _voxel_v) vox += value; return (*this); }
+    { for(auto& v : _value_v) v += value; return (*this); }
     inline VoxelSet& operator -= (float value)
-    { for(auto& vox : _voxel_v) vox -= value; return (*this); }
+    { for(auto& v : _value_v) v -= value; return (*this); }
     inline VoxelSet& operator *= (float factor)
-    { for(auto& vox : _voxel_v) vox *= factor; return (*this); }
+    { for(auto& v : _value_v) v *= factor; return (*this); }
     inline VoxelSet& operator /= (float factor)
-    { for(auto& vox : _voxel_v) vox /= factor; return (*this); }
+    { for(auto& v : _value_v) v /= factor; return (*this); }
     inline VoxelSet& operator =  (float value)
     { paint(value); return (*this); }
 
     // assign & move assign operators
     inline VoxelSet& operator=(const VoxelSet & rhs) = default;
-    inline VoxelSet& operator=(VoxelSet && rhs) noexcept { _id = rhs._id; _voxel_v = std::move(rhs._voxel_v); return *this; }
+    inline VoxelSet& operator=(VoxelSet && rhs) noexcept
+    { _id = rhs._id; _id_v = std::move(rhs._id_v); _value_v = std::move(rhs._value_v); _staged = rhs._staged; return *this; }
 
     // misc.
     std::string dump2cpp(const std::string & instanceName="voxSet") const;
@@ -198,10 +220,17 @@ namespace supera {
       std::vector<float>& value_v) const;
 
   private:
+    /// In-place removal of voxels outside [min,max] and (optionally) invalid values
+    void compact(float min, float max, bool clear_invalid_float, bool clear_nan, bool clear_inf);
+
     /// Instance ID
     InstanceID_t _id;
-    /// Ordered sparse vector of voxels
-    std::vector<supera::Voxel> _voxel_v;
+    /// Ordered sparse vector of voxel IDs
+    std::vector<supera::VoxelID_t> _id_v;
+    /// Voxel values, index-aligned with _id_v
+    std::vector<float> _value_v;
+    /// Set while _id_v/_value_v hold staged (unordered) voxels
+    bool _staged;
   };
 
   /**
@@ -0,0 +1,108 @@
+#ifndef __SUPERA_VOXELBOUNDS_CXX__
+#define __SUPERA_VOXELBOUNDS_CXX__
+
+#include "VoxelBounds.h"
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+namespace supera {
+
+  void VoxelBounds::clear()
+  {
+    _min.fill(std::numeric_limits<size_t>::max());
+    _max.fill(0);
+  }
+
+  void VoxelBounds::extend(size_t x, size_t y, size_t z)
+  {
+    if(x < _min[0]) _min[0] = x;
+    if(y < _min[1]) _min[1] = y;
+    if(z < _min[2]) _min[2] = z;
+    if(x > _max[0]) _max[0] = x;
+    if(y > _max[1]) _max[1] = y;
+    if(z > _max[2]) _max[2] = z;
+  }
+
+  void VoxelBounds::extend(const VoxelBounds& rhs)
+  {
+    if(rhs.empty()) return;
+    for(size_t axis=0; axis<3; ++axis) {
+      if(rhs._min[axis] < _min[axis]) _min[axis] = rhs._min[axis];
+      if(rhs._max[axis] > _max[axis]) _max[axis] = rhs._max[axis];
+    }
+  }
+
+  bool VoxelBounds::near(const VoxelBounds& rhs, size_t distance) const
+  {
+    if(empty() || rhs.empty()) return false;
+    for(size_t axis=0; axis<3; ++axis) {
+      if(_min[axis] > rhs._max[axis] + distance) return false;
+      if(rhs._min[axis] > _max[axis] + distance) return false;
+    }
+    return true;
+  }
+
+  std::string VoxelBounds::dump() const
+  {
+    std::stringstream ss;
+    if(empty()) ss << "(empty)";
+    else
+      ss << "(" << _min[0] << "," << _min[1] << "," << _min[2] << ") => ("
+         << _max[0] << "," << _max[1] << "," << _max[2] << ")";
+    return ss.str();
+  }
+
+  std::vector<std::vector<size_t> > SweepAndPrune(const std::vector<supera::VoxelBounds>& bounds_v,
+    size_t distance)
+  {
+    std::vector<std::vector<size_t> > result(bounds_v.size());
+
+    std::vector<size_t> order;
+    order.reserve(bounds_v.size());
+    VoxelBounds total;
+    for(size_t idx=0; idx<bounds_v.size(); ++idx) {
+      if(bounds_v[idx].empty()) continue;
+      order.push_back(idx);
+      total.extend(bounds_v[idx]);
+    }
+    if(order.size() < 2) return result;
+
+    // Sweep along the axis where the boxes are spread the most
+    size_t axis = 0;
+    for(size_t a=1; a<3; ++a) {
+      if(total.max(a) - total.min(a) > total.max(axis) - total.min(axis))
+        axis = a;
+    }
+    std::sort(order.begin(), order.end(),
+      [&bounds_v,axis](size_t a, size_t b) {
+        if(bounds_v[a].min(axis) != bounds_v[b].min(axis))
+          return bounds_v[a].min(axis) < bounds_v[b].min(axis);
+        return a < b;
+      });
+
+    // Boxes ending before the sweep position (minus distance) can never pair again
+    std::vector<size_t> active;
+    for(auto const& idx : order) {
+      auto const& box = bounds_v[idx];
+      size_t w = 0;
+      for(size_t r=0; r<active.size(); ++r) {
+        auto const& other = active[r];
+        if(bounds_v[other].max(axis) + distance < box.min(axis)) continue;
+        active[w++] = other;
+        if(box.near(bounds_v[other], distance)) {
+          result[idx].push_back(other);
+          result[other].push_back(idx);
+        }
+      }
+      active.resize(w);
+      active.push_back(idx);
+    }
+
+    for(auto& pairs : result)
+      std::sort(pairs.begin(), pairs.end());
+    return result;
+  }
+
+}
+#endif
@@ -0,0 +1,70 @@
+/**
+ * \file VoxelBounds.h
+ *
+ * \ingroup base
+ *
+ * \brief Class def header for a class supera::VoxelBounds
+ *
+ */
+
+/** \addtogroup base
+    @{*/
+#ifndef SUPERA_VOXELBOUNDS_H
+#define SUPERA_VOXELBOUNDS_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace supera {
+
+  /**
+     \class VoxelBounds
+     @brief Inclusive range of voxel indices (along x, y and z) covered by a set of voxels. \n
+     Used as a cheap spatial reject before voxel-level comparisons.
+  */
+  class VoxelBounds {
+  public:
+    /// Default ctor (empty bounds)
+    VoxelBounds() { clear(); }
+    /// Default dtor
+    ~VoxelBounds() = default;
+
+    /// Reset to empty bounds
+    void clear();
+    /// True if no voxel has been added
+    inline bool empty() const { return _min[0] > _max[0]; }
+    /// Lower index along an axis (0=x, 1=y, 2=z)
+    inline size_t min(size_t axis) const { return _min[axis]; }
+    /// Upper index along an axis (0=x, 1=y, 2=z)
+    inline size_t max(size_t axis) const { return _max[axis]; }
+
+    /// Include a voxel index
+    void extend(size_t x, size_t y, size_t z);
+    /// Include other bounds
+    void extend(const VoxelBounds& rhs);
+    /// True if both bounds are non-empty and within distance of each other along every axis
+    bool near(const VoxelBounds& rhs, size_t distance) const;
+
+    inline bool operator==(const VoxelBounds& rhs) const
+    { return _min == rhs._min && _max == rhs._max; }
+    inline bool operator!=(const VoxelBounds& rhs) const
+    { return !((*this) == rhs); }
+
+    std::string dump() const;
+
+  private:
+    std::array<size_t,3> _min; ///< lower voxel index along x, y, z
+    std::array<size_t,3> _max; ///< upper voxel index along x, y, z
+  };
+
+  /// Sweep-and-prune broad phase: for every entry of bounds_v, the sorted list of the other
+  /// entries that are near (VoxelBounds::near) to it. Empty bounds have no pairs.
+  std::vector<std::vector<size_t> > SweepAndPrune(const std::vector<supera::VoxelBounds>& bounds_v,
+    size_t distance);
+
+}
+
+#endif
+/** @} */ // end of doxygen group
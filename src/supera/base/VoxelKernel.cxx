@@ -0,0 +1,297 @@
+#ifndef __SUPERA_VOXELKERNEL_CXX__
+#define __SUPERA_VOXELKERNEL_CXX__
+
+#include "VoxelKernel.h"
+#include <atomic>
+#include <cmath>
+
+#if !defined(SUPERA_DISABLE_SIMD) && defined(__GNUC__) && defined(__x86_64__)
+#define SUPERA_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace supera {
+  namespace simd {
+
+    static_assert(sizeof(VoxelID_t) == 8, "VoxelKernel assumes 64-bit voxel IDs");
+
+    //
+    // Scalar kernels
+    //
+    // Sum uses 8 interleaved partial sums combined pairwise so that it reproduces
+    // the vectorized kernels bit-for-bit.
+    static float SumScalar(const float* value, size_t n)
+    {
+      float acc[8] = {0.,0.,0.,0.,0.,0.,0.,0.};
+      size_t i = 0;
+      for(; i+8 <= n; i+=8) {
+        for(size_t l=0; l<8; ++l) acc[l] += value[i+l];
+      }
+      float res = ((acc[0]+acc[4]) + (acc[2]+acc[6])) + ((acc[1]+acc[5]) + (acc[3]+acc[7]));
+      for(; i<n; ++i) res += value[i];
+      return res;
+    }
+
+    static float MaxScalar(const float* value, size_t n, float init)
+    {
+      float val = init;
+      for(size_t i=0; i<n; ++i) if(value[i] > val) val = value[i];
+      return val;
+    }
+
+    static float MinScalar(const float* value, size_t n, float init)
+    {
+      float val = init;
+      for(size_t i=0; i<n; ++i) if(value[i] < val) val = value[i];
+      return val;
+    }
+
+    static inline bool Keep(float x, const Cut_t& cut)
+    {
+      if(x < cut.lo || x > cut.hi) return false;
+      if(cut.drop_nan && std::isnan(x)) return false;
+      if(cut.drop_inf && std::isinf(x)) return false;
+      if(cut.drop_invalid && x == kINVALID_FLOAT) return false;
+      return true;
+    }
+
+    /// Compact [r,n) into the arrays starting at w (w <= r), returns the new write position
+    static size_t CompactTail(VoxelID_t* id, float* value, size_t w, size_t r, size_t n, const Cut_t& cut)
+    {
+      for(; r<n; ++r) {
+        if(!Keep(value[r],cut)) continue;
+        if(w != r) { id[w] = id[r]; value[w] = value[r]; }
+        ++w;
+      }
+      return w;
+    }
+
+    static size_t CompactScalar(VoxelID_t* id, float* value, size_t n, const Cut_t& cut)
+    { return CompactTail(id, value, 0, 0, n, cut); }
+
+#ifdef SUPERA_X86_SIMD
+    //
+    // AVX2 kernels
+    //
+    __attribute__((target("avx2")))
+    static float SumAVX2(const float* value, size_t n)
+    {
+      __m256 acc = _mm256_setzero_ps();
+      size_t i = 0;
+      for(; i+8 <= n; i+=8)
+        acc = _mm256_add_ps(acc, _mm256_loadu_ps(value+i));
+      __m128 s = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc,1));
+      s = _mm_add_ps(s, _mm_movehl_ps(s,s));
+      s = _mm_add_ss(s, _mm_shuffle_ps(s,s,0x55));
+      float res = _mm_cvtss_f32(s);
+      for(; i<n; ++i) res += value[i];
+      return res;
+    }
+
+    // max/min(x,acc) return acc when x is NaN, same as the scalar comparison
+    __attribute__((target("avx2")))
+    static float MaxAVX2(const float* value, size_t n, float init)
+    {
+      __m256 acc = _mm256_set1_ps(init);
+      size_t i = 0;
+      for(; i+8 <= n; i+=8)
+        acc = _mm256_max_ps(_mm256_loadu_ps(value+i), acc);
+      __m128 s = _mm_max_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc,1));
+      s = _mm_max_ps(s, _mm_movehl_ps(s,s));
+      s = _mm_max_ss(s, _mm_shuffle_ps(s,s,0x55));
+      return MaxScalar(value+i, n-i, _mm_cvtss_f32(s));
+    }
+
+    __attribute__((target("avx2")))
+    static float MinAVX2(const float* value, size_t n, float init)
+    {
+      __m256 acc = _mm256_set1_ps(init);
+      size_t i = 0;
+      for(; i+8 <= n; i+=8)
+        acc = _mm256_min_ps(_mm256_loadu_ps(value+i), acc);
+      __m128 s = _mm_min_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc,1));
+      s = _mm_min_ps(s, _mm_movehl_ps(s,s));
+      s = _mm_min_ss(s, _mm_shuffle_ps(s,s,0x55));
+      return MinScalar(value+i, n-i, _mm_cvtss_f32(s));
+    }
+
+    // AVX2 has no compress instruction: the keep mask is computed 8 values at a time,
+    // blocks that are entirely kept are skipped and the rest is moved branch-free.
+    __attribute__((target("avx2")))
+    static size_t CompactAVX2(VoxelID_t* id, float* value, size_t n, const Cut_t& cut)
+    {
+      const __m256 lo = _mm256_set1_ps(cut.lo);
+      const __m256 hi = _mm256_set1_ps(cut.hi);
+      const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+      const __m256 inf = _mm256_set1_ps(INFINITY);
+      const __m256 invalid = _mm256_set1_ps(kINVALID_FLOAT);
+      size_t w = 0, r = 0;
+      for(; r+8 <= n; r+=8) {
+        __m256 x = _mm256_loadu_ps(value+r);
+        __m256 keep = _mm256_and_ps(_mm256_cmp_ps(x, lo, _CMP_NLT_UQ), _mm256_cmp_ps(x, hi, _CMP_NGT_UQ));
+        if(cut.drop_nan)
+          keep = _mm256_and_ps(keep, _mm256_cmp_ps(x, x, _CMP_ORD_Q));
+        if(cut.drop_inf)
+          keep = _mm256_and_ps(keep, _mm256_cmp_ps(_mm256_and_ps(x, abs_mask), inf, _CMP_NEQ_UQ));
+        if(cut.drop_invalid)
+          keep = _mm256_and_ps(keep, _mm256_cmp_ps(x, invalid, _CMP_NEQ_UQ));
+        unsigned int mask = _mm256_movemask_ps(keep);
+        if(mask == 0xFF && w == r) { w += 8; continue; }
+        for(size_t b=0; b<8; ++b) {
+          id[w] = id[r+b];
+          value[w] = value[r+b];
+          w += (mask >> b) & 1;
+        }
+      }
+      return CompactTail(id, value, w, r, n, cut);
+    }
+
+    //
+    // AVX-512 kernels
+    //
+    // The sum stays on the 8-lane AVX2 kernel to keep the result independent of the ISA.
+    // (the maskz_ forms avoid a spurious GCC 12 -Wmaybe-uninitialized in max/min_ps)
+    __attribute__((target("avx512f")))
+    static float MaxAVX512(const float* value, size_t n, float init)
+    {
+      __m512 acc = _mm512_set1_ps(init);
+      size_t i = 0;
+      for(; i+16 <= n; i+=16)
+        acc = _mm512_maskz_max_ps(0xFFFF, _mm512_loadu_ps(value+i), acc);
+      float lane[16];
+      _mm512_storeu_ps(lane, acc);
+      return MaxAVX2(value+i, n-i, MaxScalar(lane, 16, init));
+    }
+
+    __attribute__((target("avx512f")))
+    static float MinAVX512(const float* value, size_t n, float init)
+    {
+      __m512 acc = _mm512_set1_ps(init);
+      size_t i = 0;
+      for(; i+16 <= n; i+=16)
+        acc = _mm512_maskz_min_ps(0xFFFF, _mm512_loadu_ps(value+i), acc);
+      float lane[16];
+      _mm512_storeu_ps(lane, acc);
+      return MinAVX2(value+i, n-i, MinScalar(lane, 16, init));
+    }
+
+    // 16 values and their ids are compressed per iteration. Stores land at or before
+    // the block being read, which is already loaded, so in-place operation is safe.
+    __attribute__((target("avx512f")))
+    static size_t CompactAVX512(VoxelID_t* id, float* value, size_t n, const Cut_t& cut)
+    {
+      const __m512 lo = _mm512_set1_ps(cut.lo);
+      const __m512 hi = _mm512_set1_ps(cut.hi);
+      const __m512i abs_mask = _mm512_set1_epi32(0x7fffffff);
+      const __m512 inf = _mm512_set1_ps(INFINITY);
+      const __m512 invalid = _mm512_set1_ps(kINVALID_FLOAT);
+      size_t w = 0, r = 0;
+      for(; r+16 <= n; r+=16) {
+        __m512 x = _mm512_loadu_ps(value+r);
+        __mmask16 keep = _mm512_cmp_ps_mask(x, lo, _CMP_NLT_UQ) & _mm512_cmp_ps_mask(x, hi, _CMP_NGT_UQ);
+        if(cut.drop_nan)
+          keep &= _mm512_cmp_ps_mask(x, x, _CMP_ORD_Q);
+        if(cut.drop_inf)
+          keep &= _mm512_cmp_ps_mask(_mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(x), abs_mask)), inf, _CMP_NEQ_UQ);
+        if(cut.drop_invalid)
+          keep &= _mm512_cmp_ps_mask(x, invalid, _CMP_NEQ_UQ);
+        if(keep == 0xFFFF && w == r) { w += 16; continue; }
+        __m512i id_lo = _mm512_loadu_si512((const void*)(id+r));
+        __m512i id_hi = _mm512_loadu_si512((const void*)(id+r+8));
+        __mmask8 keep_lo = (__mmask8)(keep & 0xFF);
+        __mmask8 keep_hi = (__mmask8)(keep >> 8);
+        _mm512_mask_compressstoreu_ps(value+w, keep, x);
+        _mm512_mask_compressstoreu_epi64(id+w, keep_lo, id_lo);
+        w += __builtin_popcount(keep_lo);
+        _mm512_mask_compressstoreu_epi64(id+w, keep_hi, id_hi);
+        w += __builtin_popcount(keep_hi);
+      }
+      return CompactTail(id, value, w, r, n, cut);
+    }
+#endif
+
+    //
+    // Dispatch
+    //
+    ISA_t AvailableISA()
+    {
+#ifdef SUPERA_X86_SIMD
+      static const ISA_t isa = (__builtin_cpu_supports("avx512f") ? kAVX512 :
+        (__builtin_cpu_supports("avx2") ? kAVX2 : kScalar));
+      return isa;
+#else
+      return kScalar;
+#endif
+    }
+
+    static std::atomic<int>& CurrentISA()
+    {
+      static std::atomic<int> isa(AvailableISA());
+      return isa;
+    }
+
+    ISA_t ISA() { return (ISA_t)(CurrentISA().load(std::memory_order_relaxed)); }
+
+    ISA_t SetISA(ISA_t isa)
+    {
+      if(isa > AvailableISA()) isa = AvailableISA();
+      CurrentISA().store(isa, std::memory_order_relaxed);
+      return isa;
+    }
+
+    const char* ISAName(ISA_t isa)
+    {
+      switch(isa) {
+        case kAVX512: return "AVX-512";
+        case kAVX2:   return "AVX2";
+        default:      return "scalar";
+      }
+    }
+
+    float Sum(const float* value, size_t n)
+    {
+#ifdef SUPERA_X86_SIMD
+      if(ISA() >= kAVX2) return SumAVX2(value, n);
+#endif
+      return SumScalar(value, n);
+    }
+
+    float Max(const float* value, size_t n, float init)
+    {
+#ifdef SUPERA_X86_SIMD
+      switch(ISA()) {
+        case kAVX512: return MaxAVX512(value, n, init);
+        case kAVX2:   return MaxAVX2(value, n, init);
+        default: break;
+      }
+#endif
+      return MaxScalar(value, n, init);
+    }
+
+    float Min(const float* value, size_t n, float init)
+    {
+#ifdef SUPERA_X86_SIMD
+      switch(ISA()) {
+        case kAVX512: return MinAVX512(value, n, init);
+        case kAVX2:   return MinAVX2(value, n, init);
+        default: break;
+      }
+#endif
+      return MinScalar(value, n, init);
+    }
+
+    size_t Compact(VoxelID_t* id, float* value, size_t n, const Cut_t& cut)
+    {
+#ifdef SUPERA_X86_SIMD
+      switch(ISA()) {
+        case kAVX512: return CompactAVX512(id, value, n, cut);
+        case kAVX2:   return CompactAVX2(id, value, n, cut);
+        default: break;
+      }
+#endif
+      return CompactScalar(id, value, n, cut);
+    }
+
+  }
+}
+#endif
@@ -0,0 +1,69 @@
+/**
+ * \file VoxelKernel.h
+ *
+ * \ingroup base
+ *
+ * \brief Vectorized kernels over the VoxelSet value/id arrays
+ *
+ */
+
+/** \addtogroup base
+    @{*/
+#ifndef SUPERA_VOXELKERNEL_H
+#define SUPERA_VOXELKERNEL_H
+
+#include "SuperaType.h"
+
+#include <cstddef>
+
+namespace supera {
+
+  /// Kernels working on the structure-of-arrays storage of VoxelSet.
+  /// The instruction set is picked at run time (AVX-512, AVX2 or scalar);
+  /// define SUPERA_DISABLE_SIMD at build time to always use the scalar code.
+  namespace simd {
+
+    /// Instruction set used by the kernels
+    enum ISA_t {
+      kScalar, ///< Plain C++ loops
+      kAVX2,   ///< 256-bit AVX2
+      kAVX512  ///< 512-bit AVX-512F
+    };
+
+    /// Best instruction set supported by this CPU (and build)
+    ISA_t AvailableISA();
+    /// Instruction set currently in use
+    ISA_t ISA();
+    /// Change the instruction set in use (capped at AvailableISA). Returns the one actually set.
+    ISA_t SetISA(ISA_t isa);
+    /// Name of the instruction set
+    const char* ISAName(ISA_t isa);
+
+    /// Sum of values. The accumulation order is the same for every ISA, so the result is too. \n
+    /// It is not the order of a plain sequential loop (8 interleaved partial sums), so sums differ
+    /// from those of earlier releases by float rounding: compare them with a relative tolerance (~1e-5).
+    float Sum(const float* value, size_t n);
+    /// Largest of init and the values (NaN values are ignored)
+    float Max(const float* value, size_t n, float init);
+    /// Smallest of init and the values (NaN values are ignored)
+    float Min(const float* value, size_t n, float init);
+
+    /// Selection used by Compact: a voxel is removed if its value is below lo, above hi,
+    /// or (when the corresponding flag is set) NaN, +/-inf or equal to kINVALID_FLOAT.
+    struct Cut_t {
+      float lo;
+      float hi;
+      bool drop_nan;
+      bool drop_inf;
+      bool drop_invalid;
+    };
+
+    /// Remove the voxels rejected by cut from the parallel id/value arrays, in place and keeping order.
+    /// Returns the number of voxels kept (the arrays are left to be resized by the caller).
+    size_t Compact(VoxelID_t* id, float* value, size_t n, const Cut_t& cut);
+
+  }
+}
+
+#endif
+/** @} */ // end of doxygen group
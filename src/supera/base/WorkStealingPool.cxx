@@ -0,0 +1,155 @@
+#ifndef __SUPERA_WORKSTEALINGPOOL_CXX__
+#define __SUPERA_WORKSTEALINGPOOL_CXX__
+
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <exception>
+
+namespace supera {
+
+  namespace {
+    /// Block of task indices owned by one worker: the owner takes from the front, thieves from the back
+    struct TaskRange_t {
+      std::mutex mtx;
+      size_t front = 0;
+      size_t back  = 0;
+    };
+  }
+
+  /// One run(): the task blocks of every participating thread and the first error
+  struct WorkStealingPool::Job_t {
+    Job_t(size_t num_tasks, size_t num_threads, const std::function<void(size_t,size_t)>& fn)
+      : task(fn), range_v(num_threads), abort(false)
+    {
+      for(size_t thread=0; thread<num_threads; ++thread) {
+        range_v[thread].front = num_tasks * thread / num_threads;
+        range_v[thread].back  = num_tasks * (thread + 1) / num_threads;
+      }
+    }
+
+    /// Own block first, then steal the last task of the block with the most left
+    bool next(size_t thread, size_t& index)
+    {
+      {
+        auto& own = range_v[thread];
+        std::lock_guard<std::mutex> lock(own.mtx);
+        if(own.front < own.back) { index = own.front++; return true; }
+      }
+      while(true) {
+        size_t victim = range_v.size();
+        size_t most = 0;
+        for(size_t other=0; other<range_v.size(); ++other) {
+          if(other == thread) continue;
+          std::lock_guard<std::mutex> lock(range_v[other].mtx);
+          size_t left = range_v[other].back - range_v[other].front;
+          if(left > most) { most = left; victim = other; }
+        }
+        if(victim == range_v.size()) return false;
+        std::lock_guard<std::mutex> lock(range_v[victim].mtx);
+        // the victim may have drained its block since it was picked
+        if(range_v[victim].front < range_v[victim].back) { index = --range_v[victim].back; return true; }
+      }
+    }
+
+    void work(size_t thread)
+    {
+      size_t index = 0;
+      while(!abort && next(thread, index)) {
+        try { task(index, thread); }
+        catch(...) {
+          std::lock_guard<std::mutex> lock(error_mtx);
+          if(!error) error = std::current_exception();
+          abort = true;
+        }
+      }
+    }
+
+    const std::function<void(size_t,size_t)>& task;
+    std::vector<TaskRange_t> range_v;
+    std::atomic<bool> abort;
+    std::exception_ptr error;
+    std::mutex error_mtx;
+  };
+
+  WorkStealingPool::WorkStealingPool(size_t num_threads)
+    : _num_threads(num_threads)
+    , _job(nullptr)
+    , _generation(0)
+    , _num_active(0)
+    , _stop(false)
+    , _busy(false)
+  {
+    if(!_num_threads) _num_threads = std::max(1u, std::thread::hardware_concurrency());
+    _thread_v.reserve(_num_threads - 1);
+    try {
+      for(size_t thread=1; thread<_num_threads; ++thread)
+        _thread_v.emplace_back(&WorkStealingPool::WorkerLoop, this, thread);
+    }
+    catch(...) {
+      // could not start a thread: run with the ones that did start
+    }
+    _num_threads = _thread_v.size() + 1;
+  }
+
+  WorkStealingPool::~WorkStealingPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      _stop = true;
+    }
+    _start_cv.notify_all();
+    for(auto& t : _thread_v) t.join();
+  }
+
+  void WorkStealingPool::WorkerLoop(size_t thread)
+  {
+    size_t generation = 0;
+    while(true) {
+      Job_t* job = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(_mtx);
+        _start_cv.wait(lock, [this, generation] { return _stop || _generation != generation; });
+        if(_stop) return;
+        generation = _generation;
+        job = _job;
+      }
+      // small jobs only involve the first threads
+      if(thread < job->range_v.size()) job->work(thread);
+      {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if(--_num_active == 0) _done_cv.notify_one();
+      }
+    }
+  }
+
+  void WorkStealingPool::run(size_t num_tasks, const std::function<void(size_t,size_t)>& task)
+  {
+    if(!num_tasks) return;
+    size_t num_threads = std::min(_num_threads, num_tasks);
+    bool idle = false;
+    if(num_threads < 2 || !_busy.compare_exchange_strong(idle, true)) {
+      for(size_t index=0; index<num_tasks; ++index) task(index, 0);
+      return;
+    }
+
+    Job_t job(num_tasks, num_threads, task);
+    {
+      std::lock_guard<std::mutex> lock(_mtx);
+      _job = &job;
+      _num_active = _thread_v.size();
+      ++_generation;
+    }
+    _start_cv.notify_all();
+    job.work(0);
+    {
+      std::unique_lock<std::mutex> lock(_mtx);
+      _done_cv.wait(lock, [this] { return _num_active == 0; });
+      _job = nullptr;
+    }
+    _busy = false;
+
+    if(job.error) std::rethrow_exception(job.error);
+  }
+
+}
+#endif
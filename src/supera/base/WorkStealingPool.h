@@ -0,0 +1,77 @@
+/**
+ * \file WorkStealingPool.h
+ *
+ * \ingroup base
+ *
+ * \brief Class def header for a class supera::WorkStealingPool
+ *
+ */
+
+/** \addtogroup base
+    @{*/
+#ifndef SUPERA_WORKSTEALINGPOOL_H
+#define SUPERA_WORKSTEALINGPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace supera {
+
+  /**
+     \class WorkStealingPool
+     @brief Runs batches of independent tasks on a fixed set of persistent threads. \n
+     The num_threads-1 worker threads are started once and reused by every run(); the calling thread is worker 0. \n
+     Every thread starts with a contiguous block of task indices and takes them from the front. \n
+     A thread that runs dry steals from the back of the busiest other block, so a few expensive \n
+     tasks do not leave the other threads idle. \n
+     One run() at a time uses the workers: a run() issued while the pool is busy (from another thread, \n
+     or from inside a task) executes its tasks serially on the calling thread, so nested pools never multiply threads.
+  */
+  class WorkStealingPool {
+  public:
+    /// Constructor: num_threads=0 uses the number of hardware threads
+    WorkStealingPool(size_t num_threads=0);
+    /// Stops and joins the workers
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /// Number of threads (workers plus the calling thread)
+    inline size_t num_threads() const { return _num_threads; }
+
+    /// True while a run() is using the workers
+    inline bool busy() const { return _busy; }
+
+    /// Call task(index, thread) for every index in [0,num_tasks) and wait for all of them. \n
+    /// thread is in [0,num_threads()) and identifies the worker (e.g. for per-thread scratch space). \n
+    /// If a task throws, the remaining tasks are abandoned and the first exception is rethrown here.
+    void run(size_t num_tasks, const std::function<void(size_t,size_t)>& task);
+
+  private:
+    struct Job_t;
+
+    /// Body of worker thread: wait for a job, take part in it, report back
+    void WorkerLoop(size_t thread);
+
+    size_t _num_threads;              ///< number of threads, including the one calling run()
+    std::vector<std::thread> _thread_v; ///< persistent workers 1..num_threads-1
+    std::mutex _mtx;                  ///< guards the job hand-over below
+    std::condition_variable _start_cv; ///< signals a new job (or _stop) to the workers
+    std::condition_variable _done_cv; ///< signals run() that every worker left the job
+    Job_t* _job;                      ///< job being run (owned by run())
+    size_t _generation;               ///< incremented for every job
+    size_t _num_active;               ///< workers not done with the current job
+    bool _stop;                       ///< tells the workers to exit
+    std::atomic<bool> _busy;          ///< a run() owns the workers
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
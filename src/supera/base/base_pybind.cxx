@@ -4,10 +4,26 @@
 #include "Point.h"
 #include "BBox.h"
 #include "Voxel.h"
+#include "RunStats.h"
 
+#include "pybind11/numpy.h"
 #include "pybind11/operators.h"
+#include "pybind11/stl.h"
 #include "supera/pybind_mkdoc.h"
 
+namespace
+{
+  /// Read-only numpy view of a VoxelSet buffer: the VoxelSet is kept alive as the base object of the array.
+  /// Writing through it would break the sorted-ID invariant, and it dangles once the VoxelSet reallocates.
+  template <typename T>
+  pybind11::array_t<T> voxelset_array(const supera::VoxelSet& vs, const std::vector<T>& v)
+  {
+    pybind11::array_t<T> arr(v.size(), v.data(), pybind11::cast(vs, pybind11::return_value_policy::reference));
+    arr.attr("flags").attr("writeable") = false;
+    return arr;
+  }
+}
+
 void init_base(pybind11::module& m)
 {
   using namespace pybind11::literals;
@@ -201,6 +217,11 @@ void init_base(pybind11::module& m)
         // accessors
         .def("id", pybind11::overload_cast<>(&supera::VoxelSet::id, pybind11::const_), DOC(supera, VoxelSet, id))
         .def("as_vector", &supera::VoxelSet::as_vector, DOC(supera, VoxelSet, as_vector))
+        // zero-copy, read-only numpy views: invalid after any change to the VoxelSet (copy them to keep them)
+        .def("ids", [](const supera::VoxelSet& self) { return voxelset_array(self, self.ids()); },
+             pybind11::keep_alive<0, 1>(), DOC(supera, VoxelSet, ids))
+        .def("values", [](const supera::VoxelSet& self) { return voxelset_array(self, self.values()); },
+             pybind11::keep_alive<0, 1>(), DOC(supera, VoxelSet, values))
         .def("find", &supera::VoxelSet::find, DOC(supera, VoxelSet, find), "id"_a)
         .def("index", &supera::VoxelSet::index, DOC(supera, VoxelSet, index), "id"_a)
         .def("sum", &supera::VoxelSet::sum, DOC(supera, VoxelSet, sum))
@@ -236,9 +257,20 @@ void init_base(pybind11::module& m)
              "vs"_a, "add"_a)
         .def("paint", &supera::VoxelSet::paint, DOC(supera, VoxelSet, paint),
              "value"_a)
+        .def("stage", &supera::VoxelSet::stage, DOC(supera, VoxelSet, stage),
+             "id"_a, "value"_a)
+        .def("finalize", &supera::VoxelSet::finalize, DOC(supera, VoxelSet, finalize),
+             "add"_a)
+        .def("staged", &supera::VoxelSet::staged, DOC(supera, VoxelSet, staged))
 
         .def("id", pybind11::overload_cast<const supera::InstanceID_t>(&supera::VoxelSet::id), DOC(supera, VoxelSet, id, 2), "id"_a);
 
+    // classes from RunStats.h (RunStats is only handed out by reference, e.g. Driver.Stats())
+    pybind11::class_<supera::RunStats>(m, "RunStats", DOC(supera, RunStats))
+        .def("summary", &supera::RunStats::summary, DOC(supera, RunStats, summary))
+        .def("dump", &supera::RunStats::dump, DOC(supera, RunStats, dump))
+        .def("reset", &supera::RunStats::reset, DOC(supera, RunStats, reset));
+
 
  }
 #endif
\ No newline at end of file
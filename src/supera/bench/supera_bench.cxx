@@ -0,0 +1,386 @@
+/**
+ * \file supera_bench.cxx
+ *
+ * \brief Micro benchmarks of the voxel/geometry kernels and end-to-end benchmarks of Driver::Generate.
+ *
+ * Usage: supera_bench [--events FILE.sev]... [--scale N,N,...] [--repeat N] [--threads N] [--filter TEXT]
+ *  - --events  : binary event files (BinaryEventWriter format, e.g. PCMuon.sev saved with
+ *                supera.test.SaveTestEvents); default: every *.sev in $SUPERA_TEST_EVENTS_DIR or the test events
+ *                directory (it is an error if there is none)
+ *  - --scale   : sizes of the synthetic events (interactions per spill, see supera::test::SyntheticEvent), default 1,10,100
+ *  - --repeat  : repetitions of every benchmark (latency samples), default 20
+ *  - --threads : also benchmark Driver::GenerateBatch on this many threads (0 = skip), default 0
+ *  - --filter  : only run benchmarks whose name contains TEXT
+ *
+ * Results are printed as JSON: per-operation time percentiles for the micro benchmarks,
+ * and events/s, EDeps/s and per-event latency percentiles for the end-to-end ones.
+ */
+
+#include "supera/process/Driver.h"
+#include "supera/io/BinaryEventFile.h"
+#include "supera/test/SyntheticEvents.h"
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <dirent.h>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef SUPERA_TEST_EVENTS_DIR
+#define SUPERA_TEST_EVENTS_DIR ""
+#endif
+
+namespace {
+
+  using Clock = std::chrono::steady_clock;
+
+  /// keeps the compiler from dropping benchmarked work
+  volatile double gSink = 0;
+
+  struct Options_t {
+    std::vector<std::string> event_files;
+    std::vector<size_t> scales = {1, 10, 100};
+    size_t repeat = 20;
+    size_t threads = 0;
+    std::string filter;
+  };
+
+  /// p-th percentile (0-100) of a sample
+  double Percentile(std::vector<double> v, double p)
+  {
+    if(v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t index = std::min(v.size() - 1, (size_t)(p / 100. * (v.size() - 1) + 0.5));
+    return v[index];
+  }
+
+  std::string Quantiles(const std::vector<double>& v)
+  {
+    std::stringstream ss;
+    ss << "{\"p50\":" << Percentile(v, 50) << ",\"p90\":" << Percentile(v, 90)
+       << ",\"p99\":" << Percentile(v, 99) << ",\"max\":" << Percentile(v, 100) << "}";
+    return ss.str();
+  }
+
+  /// Collects the JSON records of every benchmark
+  class Report {
+  public:
+    explicit Report(const Options_t& opts) : _opts(opts) {}
+
+    bool Enabled(const std::string& name) const
+    { return _opts.filter.empty() || name.find(_opts.filter) != std::string::npos; }
+
+    /// Time fn() (which performs ops operations) opts.repeat times
+    template <class Fn>
+    void Micro(const std::string& name, size_t ops, Fn fn)
+    {
+      if(!Enabled(name)) return;
+      std::vector<double> ns_per_op;
+      fn(); // warm-up
+      for(size_t rep = 0; rep < _opts.repeat; ++rep) {
+        auto start = Clock::now();
+        fn();
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        ns_per_op.push_back(ns / ops);
+      }
+      std::stringstream ss;
+      ss << "{\"name\":\"" << name << "\",\"kind\":\"micro\",\"ops\":" << ops
+         << ",\"ns_per_op\":" << Quantiles(ns_per_op) << "}";
+      _records.push_back(ss.str());
+    }
+
+    /// Run Driver::Generate on every event opts.repeat times
+    void Events(const std::string& name, supera::Driver& driver, const std::vector<supera::EventInput>& events)
+    {
+      if(!Enabled(name) || events.empty()) return;
+      size_t num_edeps = 0, num_particles = 0;
+      for(auto const& ev : events) { num_edeps += CountEDeps(ev); num_particles += ev.size(); }
+
+      driver.Generate(events.front()); // warm-up
+      driver.ResetStats();
+      std::vector<double> latency_ms;
+      auto start = Clock::now();
+      for(size_t rep = 0; rep < _opts.repeat; ++rep) {
+        for(auto const& ev : events) {
+          auto t0 = Clock::now();
+          driver.Generate(ev);
+          latency_ms.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+          gSink = gSink + driver.Label().Particles().size();
+        }
+      }
+      double total_s = std::chrono::duration<double>(Clock::now() - start).count();
+      this->Throughput(name, "event", events.size(), num_particles, num_edeps, total_s, latency_ms, &driver);
+    }
+
+    /// Run Driver::GenerateBatch over all events opts.repeat times
+    void Batch(const std::string& name, supera::Driver& driver, const std::vector<supera::EventInput>& events)
+    {
+      if(!Enabled(name) || events.empty() || !_opts.threads) return;
+      size_t num_edeps = 0, num_particles = 0;
+      for(auto const& ev : events) { num_edeps += CountEDeps(ev); num_particles += ev.size(); }
+
+      std::vector<double> latency_ms;
+      auto start = Clock::now();
+      for(size_t rep = 0; rep < _opts.repeat; ++rep) {
+        auto t0 = Clock::now();
+        auto result = driver.GenerateBatch(events, _opts.threads);
+        latency_ms.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        gSink = gSink + result.size();
+      }
+      double total_s = std::chrono::duration<double>(Clock::now() - start).count();
+      this->Throughput(name, "batch", events.size(), num_particles, num_edeps, total_s, latency_ms, nullptr);
+    }
+
+    void Print(std::ostream& out) const
+    {
+      out << "{\"benchmarks\":[\n";
+      for(size_t i = 0; i < _records.size(); ++i)
+        out << (i ? ",\n" : "") << _records[i];
+      out << "\n]}\n";
+    }
+
+  private:
+    static size_t CountEDeps(const supera::EventInput& ev)
+    {
+      size_t result = ev.unassociated_edeps.size();
+      for(auto const& part : ev) result += part.pcloud.size();
+      return result;
+    }
+
+    void Throughput(const std::string& name, const char* kind, size_t num_events, size_t num_particles, size_t num_edeps,
+                    double total_s, const std::vector<double>& latency_ms, const supera::Driver* driver)
+    {
+      std::stringstream ss;
+      ss << "{\"name\":\"" << name << "\",\"kind\":\"" << kind << "\",\"events\":" << num_events
+         << ",\"particles\":" << num_particles << ",\"edeps\":" << num_edeps << ",\"threads\":" << (driver ? 1 : _opts.threads)
+         << ",\"events_per_s\":" << num_events * _opts.repeat / total_s
+         << ",\"edeps_per_s\":" << num_edeps * _opts.repeat / total_s
+         << ",\"latency_ms\":" << Quantiles(latency_ms);
+      if(driver) {
+        // the slowest stages, straight from the Driver metrics
+        ss << ",\"stage_ms\":{";
+        auto total = driver->Stats().total();
+        for(size_t stage = 0; stage < supera::kNumStatStages; ++stage)
+          ss << (stage ? "," : "") << "\"" << supera::StatName((supera::StatStage_t)stage) << "\":"
+             << total.time_ns[stage] * 1.e-6 / (num_events * _opts.repeat);
+        ss << "}";
+      }
+      ss << "}";
+      _records.push_back(ss.str());
+    }
+
+    const Options_t& _opts;
+    std::vector<std::string> _records;
+  };
+
+  // ------------------------------------------------------------------------
+
+  /// Every *.sev file in a directory
+  std::vector<std::string> EventFilesIn(const std::string& dir)
+  {
+    std::vector<std::string> result;
+    DIR* d = dir.empty() ? nullptr : opendir(dir.c_str());
+    if(!d) return result;
+    while(auto entry = readdir(d)) {
+      std::string name = entry->d_name;
+      if(name.size() > 4 && name.compare(name.size() - 4, 4, ".sev") == 0)
+        result.push_back(dir + "/" + name);
+    }
+    closedir(d);
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  supera::Driver* MakeDriver()
+  {
+    // logging goes to stdout: keep it quiet so the output stays valid JSON
+    supera::Logger::default_level(supera::msg::kERROR);
+    auto cfg = YAML::Load(R"(
+LogLevel: ERROR
+BBoxAlgorithm: BBoxInteraction
+BBoxConfig:
+  LogLevel: ERROR
+  VoxelSize: [0.4, 0.4, 0.4]
+  BBoxSize: [1000, 1000, 1000]
+  BBoxBottom: [-500, -500, -500]
+LabelAlgorithm: LArTPCMLReco3D
+LabelConfig:
+  LogLevel: ERROR
+  EnergyDepositThreshold: 0
+)");
+    auto driver = new supera::Driver;
+    driver->Configure(cfg);
+    return driver;
+  }
+
+  // ------------------------------------------------------------------------
+
+  void MicroBenchmarks(Report& report)
+  {
+    supera::ImageMeta3D meta;
+    meta.set(-500, -500, -500, 500, 500, 500, 2500, 2500, 2500);
+
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<double> coord(-499., 499.);
+    const size_t n = 1 << 16;
+    std::vector<supera::Point3D> points(n);
+    for(auto& pt : points) { pt.x = coord(rng); pt.y = coord(rng); pt.z = coord(rng); }
+    std::vector<supera::VoxelID_t> ids(n);
+    for(size_t i = 0; i < n; ++i) ids[i] = meta.id(points[i]);
+
+    report.Micro("ImageMeta3D::id", n, [&]() {
+      supera::VoxelID_t sum = 0;
+      for(auto const& pt : points) sum += meta.id(pt);
+      gSink = gSink + sum;
+    });
+
+    report.Micro("ImageMeta3D::id_to_xyz_index", n, [&]() {
+      size_t x, y, z, sum = 0;
+      for(auto const& id : ids) { meta.id_to_xyz_index(id, x, y, z); sum += x + y + z; }
+      gSink = gSink + sum;
+    });
+
+    // random order: every emplace is an insertion into a sorted set
+    report.Micro("VoxelSet::emplace/random", n, [&]() {
+      supera::VoxelSet vs;
+      for(auto const& id : ids) vs.emplace(id, 1.f, true);
+      gSink = gSink + vs.size();
+    });
+
+    std::vector<supera::VoxelID_t> sorted_ids(ids);
+    std::sort(sorted_ids.begin(), sorted_ids.end());
+    report.Micro("VoxelSet::emplace/sorted", n, [&]() {
+      supera::VoxelSet vs;
+      for(auto const& id : sorted_ids) vs.emplace(id, 1.f, true);
+      gSink = gSink + vs.size();
+    });
+
+    report.Micro("VoxelSet::stage+finalize", n, [&]() {
+      supera::VoxelSet vs;
+      for(auto const& id : ids) vs.stage(id, 1.f);
+      vs.finalize(true);
+      gSink = gSink + vs.size();
+    });
+
+    // touching: the same pair of parallel tracks at every length, folded into rows of 2000 voxels along z.
+    // b runs two voxels below a, so "apart" never touches and the scan covers every voxel of b (the probed set);
+    // "contact" moves the last voxel of b (in id order) next to a, so the only contact ends that same scan.
+    for(size_t length : {100, 1000, 10000}) {
+      supera::VoxelSet a, b_apart, b_contact;
+      std::vector<supera::VoxelID_t> b_ids;
+      for(size_t i = 0; i < length; ++i) {
+        size_t x = 100 + 10 * (i / 2000), z = 100 + i % 2000;
+        a.stage(meta.index(x, 102, z), 1.f);
+        b_ids.push_back(meta.index(x, 100, z));
+      }
+      // moving up one row keeps it the largest id
+      auto last = *std::max_element(b_ids.begin(), b_ids.end());
+      for(auto const& id : b_ids) {
+        b_apart.stage(id, 1.f);
+        b_contact.stage(id == last ? id + meta.num_voxel_x() : id, 1.f);
+      }
+      a.finalize(true);
+      b_apart.finalize(true);
+      b_contact.finalize(true);
+      if(meta.touching(a, b_apart, 1) || !meta.touching(a, b_contact, 1))
+        throw std::logic_error("touching benchmark tracks are not laid out as intended");
+
+      report.Micro("ImageMeta3D::touching/apart/" + std::to_string(length), 1, [&]() {
+        gSink = gSink + meta.touching(a, b_apart, 1);
+      });
+      report.Micro("ImageMeta3D::touching/contact/" + std::to_string(length), 1, [&]() {
+        gSink = gSink + meta.touching(a, b_contact, 1);
+      });
+    }
+  }
+
+  void EventBenchmarks(Report& report, const Options_t& opts)
+  {
+    std::unique_ptr<supera::Driver> driver(MakeDriver());
+
+    // recorded fixtures (e.g. PCMuon)
+    for(auto const& file_name : opts.event_files) {
+      supera::BinaryEventFile file(file_name);
+      for(size_t entry = 0; entry < file.NumEvents(); ++entry) {
+        std::vector<supera::EventInput> events(1, file.Input(entry));
+        report.Events("Generate/" + file.Name(entry), *driver, events);
+        report.Batch("GenerateBatch/" + file.Name(entry), *driver, std::vector<supera::EventInput>(16, events.front()));
+      }
+    }
+
+    // synthetic spills of growing size
+    for(auto const& scale : opts.scales) {
+      std::vector<supera::EventInput> events;
+      supera::test::SyntheticEventConfig cfg;
+      cfg.num_interactions = scale;
+      cfg.unassociated_edeps = 100 * scale;
+      for(cfg.seed = 0; cfg.seed < 4; ++cfg.seed) events.push_back(supera::test::SyntheticEvent(cfg));
+      report.Events("Generate/spill/" + std::to_string(scale), *driver, events);
+      report.Batch("GenerateBatch/spill/" + std::to_string(scale), *driver, events);
+    }
+  }
+
+  std::vector<size_t> ParseSizes(const std::string& text)
+  {
+    std::vector<size_t> result;
+    std::stringstream ss(text);
+    std::string item;
+    while(std::getline(ss, item, ','))
+      if(!item.empty()) result.push_back(std::stoul(item));
+    return result;
+  }
+}
+
+int main(int argc, char** argv)
+{
+  Options_t opts;
+  for(int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    auto value = [&]() -> std::string {
+      if(i + 1 >= argc) { std::cerr << "missing value for " << arg << std::endl; std::exit(1); }
+      return argv[++i];
+    };
+    if(arg == "--events") opts.event_files.push_back(value());
+    else if(arg == "--scale") opts.scales = ParseSizes(value());
+    else if(arg == "--repeat") opts.repeat = std::max<size_t>(1, std::stoul(value()));
+    else if(arg == "--threads") opts.threads = std::stoul(value());
+    else if(arg == "--filter") opts.filter = value();
+    else {
+      std::cerr << "usage: " << argv[0]
+                << " [--events FILE.sev]... [--scale N,N,...] [--repeat N] [--threads N] [--filter TEXT]" << std::endl;
+      return arg == "--help" ? 0 : 1;
+    }
+  }
+  if(opts.event_files.empty()) {
+    const char* env = std::getenv("SUPERA_TEST_EVENTS_DIR");
+    std::string dir = env ? env : SUPERA_TEST_EVENTS_DIR;
+    opts.event_files = EventFilesIn(dir);
+    // a run without the recorded events would silently report the synthetic spills only
+    if(opts.event_files.empty()) {
+      std::cerr << "supera_bench: no event fixtures (*.sev) in '" << dir
+                << "': pass --events or set SUPERA_TEST_EVENTS_DIR" << std::endl;
+      return 1;
+    }
+  }
+
+  try {
+    Report report(opts);
+    MicroBenchmarks(report);
+    EventBenchmarks(report, opts);
+    report.Print(std::cout);
+  }
+  catch(const std::exception& e) {
+    std::cerr << "supera_bench failed: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
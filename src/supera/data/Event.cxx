@@ -8,6 +8,46 @@
 
 namespace supera {
 
+  namespace {
+    /// CSR cluster export shared by the flat EventOutput::FillClustersEnergy and EventOutput::FillClustersdEdX:
+    /// the target VoxelSet of every particle, then the unassociated voxels (if given) with their own values
+    /// or zeros (unassociated_values = false)
+    void FillClustersCSR(const std::vector<ParticleLabel>& particles,
+                         supera::VoxelSet ParticleLabel::* target,
+                         const supera::VoxelSet* unassociated, bool unassociated_values,
+                         std::vector<supera::VoxelID_t>& ids,
+                         std::vector<float>& values,
+                         std::vector<size_t>& offsets)
+    {
+      size_t total = unassociated ? unassociated->size() : 0;
+      for(auto const& label : particles) total += (label.*target).size();
+
+      ids.clear();
+      values.clear();
+      offsets.clear();
+      ids.reserve(total);
+      values.reserve(total);
+      offsets.reserve(particles.size() + 2);
+
+      offsets.push_back(0);
+      for(auto const& label : particles) {
+        auto const& voxels = label.*target;
+        ids.insert(ids.end(), voxels.ids().begin(), voxels.ids().end());
+        values.insert(values.end(), voxels.values().begin(), voxels.values().end());
+        offsets.push_back(ids.size());
+      }
+
+      if(unassociated) {
+        ids.insert(ids.end(), unassociated->ids().begin(), unassociated->ids().end());
+        if(unassociated_values)
+          values.insert(values.end(), unassociated->values().begin(), unassociated->values().end());
+        else
+          values.resize(ids.size(), 0.);
+        offsets.push_back(ids.size());
+      }
+    }
+  }
+
   // --------------------------------------------------------
   /*
   const supera::VoxelSet &EventOutput::VoxelDeDxs() const
@@ -175,30 +215,13 @@ namespace supera {
 
     for(size_t i=0; i<_particles.size(); ++i) {
       auto const& target = _particles[i].energy;
-      auto& id_v = ids[i];
-      auto& value_v = values[i];
-      id_v.clear();
-      value_v.clear();
-      id_v.reserve(target.size());
-      value_v.reserve(target.size());
-      for(auto const& vox : target.as_vector()) {
-        id_v.push_back(vox.id());
-        value_v.push_back(vox.value());
-      }
+      ids[i] = target.ids();
+      values[i] = target.values();
     }
 
     if(fill_unassociated) {
-      auto const& unass = _unassociated_voxels.as_vector();
-      std::vector<supera::VoxelID_t> id_v;
-      std::vector<float> value_v;
-      id_v.resize(unass.size());
-      value_v.resize(unass.size());
-      for(size_t i=0; i<unass.size(); ++i){
-        id_v[i] = unass[i].id();
-        value_v[i] = unass[i].value();
-      }
-      ids.push_back(id_v);
-      values.push_back(value_v);
+      ids.push_back(_unassociated_voxels.ids());
+      values.push_back(_unassociated_voxels.values());
     }
   }
 
@@ -211,56 +234,46 @@ namespace supera {
 
     for(size_t i=0; i<_particles.size(); ++i) {
       auto const& target = _particles[i].dedx;
-      auto& id_v = ids[i];
-      auto& value_v = values[i];
-      id_v.clear();
-      value_v.clear();
-      id_v.reserve(target.size());
-      value_v.reserve(target.size());
-      for(auto const& vox : target.as_vector()) {
-        id_v.push_back(vox.id());
-        value_v.push_back(vox.value());
-      }
+      ids[i] = target.ids();
+      values[i] = target.values();
     }
     if(fill_unassociated) {
-      auto const& unass = _unassociated_voxels.as_vector();
-      std::vector<supera::VoxelID_t> id_v;
-      std::vector<float> value_v;
-      id_v.resize(unass.size());
-      value_v.resize(unass.size(),0.);
-      for(size_t i=0; i<unass.size(); ++i)
-        id_v[i] = unass[i].id();
-      ids.push_back(id_v);
-      values.push_back(value_v);
+      ids.push_back(_unassociated_voxels.ids());
+      values.push_back(std::vector<float>(_unassociated_voxels.size(),0.));
     }
   }
 
+  void EventOutput::FillClustersEnergy(std::vector<supera::VoxelID_t>& ids,
+    std::vector<float>& values,
+    std::vector<size_t>& offsets,
+    bool fill_unassociated) const
+  {
+    FillClustersCSR(_particles, &ParticleLabel::energy, fill_unassociated ? &_unassociated_voxels : nullptr, true,
+                    ids, values, offsets);
+  }
+
+  void EventOutput::FillClustersdEdX(std::vector<supera::VoxelID_t>& ids,
+    std::vector<float>& values,
+    std::vector<size_t>& offsets,
+    bool fill_unassociated) const
+  {
+    // unassociated voxels have no dE/dX: zero-filled
+    FillClustersCSR(_particles, &ParticleLabel::dedx, fill_unassociated ? &_unassociated_voxels : nullptr, false,
+                    ids, values, offsets);
+  }
+
   void EventOutput::FillTensorSemantic(std::vector<VoxelID_t>& ids,
     std::vector<float>& values) const
   {
-    ids.clear();
-    values.clear();
-    ids.reserve(_semanticLabels.size());
-    values.reserve(_semanticLabels.size());
-    for(auto const& vox : _semanticLabels.as_vector())
-    {
-      ids.push_back(vox.id());
-      values.push_back(vox.value());
-    }
+    ids = _semanticLabels.ids();
+    values = _semanticLabels.values();
   }
 
   void EventOutput::FillTensorEnergy(std::vector<VoxelID_t>& ids,
     std::vector<float>& values) const
   {
-    ids.clear();
-    values.clear();
-    ids.reserve(_energies.size());
-    values.reserve(_energies.size());
-    for(auto const& vox : _energies.as_vector())
-    {
-      ids.push_back(vox.id());
-      values.push_back(vox.value());
-    }
+    ids = _energies.ids();
+    values = _energies.values();
   }
 
 } // namespace supera
@@ -97,6 +97,19 @@ namespace supera
                             std::vector <std::vector<float>>& values,
                             bool fill_unassociated = true) const;
 
+      /// \brief Flat (CSR) variant of \ref FillClustersEnergy.
+      /// Cluster i occupies [offsets[i], offsets[i+1]) of \a ids and \a values, so \a offsets has one more entry than there are clusters.
+      void FillClustersEnergy(std::vector <supera::VoxelID_t>& ids,
+                              std::vector<float>& values,
+                              std::vector<size_t>& offsets,
+                              bool fill_unassociated = true) const;
+
+      /// Flat (CSR) variant of \ref FillClustersdEdX, laid out as in the CSR \ref FillClustersEnergy
+      void FillClustersdEdX(std::vector <supera::VoxelID_t>& ids,
+                            std::vector<float>& values,
+                            std::vector<size_t>& offsets,
+                            bool fill_unassociated = true) const;
+
       void FillTensorSemantic(std::vector <VoxelID_t>& ids,
                               std::vector<float>& values) const;
 
@@ -0,0 +1,101 @@
+#include "EventColumns.h"
+#include "supera/base/meatloaf.h"
+
+namespace supera {
+
+  namespace {
+    inline InstanceID_t ToInstanceID(int64_t v) { return v < 0 ? kINVALID_INSTANCEID : (InstanceID_t)v; }
+  }
+
+  const ParticleIntColumn_t kParticleIntColumns[] = {
+    {"parent_id",   [](Particle& p, int64_t v) { p.parent_trackid = ColumnToTrackID(v); }},
+    {"ancestor_id", [](Particle& p, int64_t v) { p.ancestor_trackid = ColumnToTrackID(v); }},
+    {"pdg_id",      [](Particle& p, int64_t v) { p.pdg = (PdgCode_t)v; }},
+    {"gen_id",      [](Particle& p, int64_t v) { p.genid = ColumnToTrackID(v); }},
+    {"vertex_id",   [](Particle& p, int64_t v) { p.interaction_id = ToInstanceID(v); }},
+    {"type",        [](Particle& p, int64_t v) {
+      p.type = (v >= 0 && v < kInvalidProcess) ? (ProcessType_t)v : kInvalidProcess; }},
+  };
+
+  const ParticleFloatColumn_t kParticleFloatColumns[] = {
+    {"E_start",  [](Particle& p, double v) { p.energy_init = v; }},
+    {"px_start", [](Particle& p, double v) { p.px = v; }},
+    {"py_start", [](Particle& p, double v) { p.py = v; }},
+    {"pz_start", [](Particle& p, double v) { p.pz = v; }},
+    {"px_end",   [](Particle& p, double v) { p.end_px = v; }},
+    {"py_end",   [](Particle& p, double v) { p.end_py = v; }},
+    {"pz_end",   [](Particle& p, double v) { p.end_pz = v; }},
+    {"x_start",  [](Particle& p, double v) { p.vtx.pos.x = v; }},
+    {"y_start",  [](Particle& p, double v) { p.vtx.pos.y = v; }},
+    {"z_start",  [](Particle& p, double v) { p.vtx.pos.z = v; }},
+    {"t_start",  [](Particle& p, double v) { p.vtx.time = v; }},
+    {"x_end",    [](Particle& p, double v) { p.end_pt.pos.x = v; }},
+    {"y_end",    [](Particle& p, double v) { p.end_pt.pos.y = v; }},
+    {"z_end",    [](Particle& p, double v) { p.end_pt.pos.z = v; }},
+    {"t_end",    [](Particle& p, double v) { p.end_pt.time = v; }},
+  };
+
+  const size_t kNumParticleIntColumns = sizeof(kParticleIntColumns) / sizeof(ParticleIntColumn_t);
+  const size_t kNumParticleFloatColumns = sizeof(kParticleFloatColumns) / sizeof(ParticleFloatColumn_t);
+
+  EventInput MakeEventInput(const EventInputColumns& columns)
+  {
+    const size_t np = columns.num_particles;
+    const size_t ne = columns.num_edeps;
+    if(np && !columns.traj_id)
+      throw meatloaf("MakeEventInput: traj_id column is required");
+    // see kParticleIntColumns
+    auto type_iter = columns.int_columns.find("type");
+    if(np && (type_iter == columns.int_columns.end() || !type_iter->second))
+      throw meatloaf("MakeEventInput: type column (ProcessType_t) is required");
+    if(ne && (!columns.x || !columns.y || !columns.z || !columns.e))
+      throw meatloaf("MakeEventInput: EDep x, y, z and e columns are required");
+    if(!columns.offsets)
+      throw meatloaf("MakeEventInput: EDep offsets are required");
+    // validate every range before filling: a bad offset must not read past the EDep columns
+    if(columns.offsets[0] != 0)
+      throw meatloaf("MakeEventInput: EDep offsets must start at 0");
+    for(size_t i=0; i<np; ++i) {
+      if(columns.offsets[i+1] < columns.offsets[i])
+        throw meatloaf("MakeEventInput: EDep offsets must be non-decreasing");
+    }
+    if((size_t)columns.offsets[np] > ne)
+      throw meatloaf("MakeEventInput: EDep offsets must end within the EDep columns");
+
+    EventInput event;
+    event.resize(np);
+
+    // particle columns: one sweep per column present
+    for(size_t i=0; i<np; ++i) event[i].part.trackid = ColumnToTrackID(columns.traj_id[i]);
+    for(size_t c=0; c<kNumParticleIntColumns; ++c) {
+      auto iter = columns.int_columns.find(kParticleIntColumns[c].name);
+      if(iter == columns.int_columns.end() || !iter->second) continue;
+      for(size_t i=0; i<np; ++i) kParticleIntColumns[c].set(event[i].part, iter->second[i]);
+    }
+    for(size_t c=0; c<kNumParticleFloatColumns; ++c) {
+      auto iter = columns.float_columns.find(kParticleFloatColumns[c].name);
+      if(iter == columns.float_columns.end() || !iter->second) continue;
+      for(size_t i=0; i<np; ++i) kParticleFloatColumns[c].set(event[i].part, iter->second[i]);
+    }
+
+    // EDeps: particle i owns [offsets[i], offsets[i+1]), the tail is unassociated
+    auto fill = [&columns](std::vector<EDep>& pcloud, size_t begin, size_t end) {
+      pcloud.resize(end - begin);
+      for(size_t row=begin; row<end; ++row) {
+        auto& pt = pcloud[row - begin];
+        pt.x = columns.x[row];
+        pt.y = columns.y[row];
+        pt.z = columns.z[row];
+        pt.e = columns.e[row];
+        if(columns.t) pt.t = columns.t[row];
+        if(columns.dedx) pt.dedx = columns.dedx[row];
+      }
+    };
+    for(size_t i=0; i<np; ++i)
+      fill(event[i].pcloud, columns.offsets[i], columns.offsets[i+1]);
+    fill(event.unassociated_edeps, columns.offsets[np], ne);
+
+    return event;
+  }
+
+}
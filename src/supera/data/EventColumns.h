@@ -0,0 +1,68 @@
+/**
+ * \file EventColumns.h
+ *
+ * \brief Columnar (structure-of-arrays) description of an EventInput and its conversion.
+ */
+
+#ifndef __SUPERA_EVENTCOLUMNS_H__
+#define __SUPERA_EVENTCOLUMNS_H__
+
+#include "Event.h"
+#include <map>
+
+namespace supera
+{
+  /// Setter for an integer particle column: negative track / instance ids become the kINVALID_* values
+  struct ParticleIntColumn_t {
+    const char* name;
+    void (*set)(Particle&, int64_t);
+  };
+
+  /// Setter for a floating point particle column
+  struct ParticleFloatColumn_t {
+    const char* name;
+    void (*set)(Particle&, double);
+  };
+  /// Particle columns, named after the ND-LAr flow trajectory table (traj_id is handled separately). \n
+  /// All are optional except type (ProcessType_t): without it every particle is kInvalidProcess,
+  /// which LArTPCMLReco3D refuses to label.
+  extern const ParticleIntColumn_t kParticleIntColumns[];
+  extern const ParticleFloatColumn_t kParticleFloatColumns[];
+  extern const size_t kNumParticleIntColumns;
+  extern const size_t kNumParticleFloatColumns;
+
+  /// Track id from a signed column value (negative means no track)
+  inline TrackID_t ColumnToTrackID(int64_t v) { return v < 0 ? kINVALID_TRACKID : (TrackID_t)v; }
+
+  /**
+     \class EventInputColumns
+     \brief Borrowed pointers to the columns of one event, converted to an EventInput by \ref MakeEventInput. \n
+     Particle columns have num_particles rows; traj_id and type are required and the others are looked up by the \n
+     names in kParticleIntColumns / kParticleFloatColumns (missing ones keep the Particle defaults). \n
+     EDep columns have num_edeps rows; t and dedx may be null. EDeps [offsets[i], offsets[i+1]) belong to \n
+     particle i and the rows from offsets[num_particles] to num_edeps are the unassociated_edeps.
+  */
+  class EventInputColumns
+  {
+  public:
+    EventInputColumns()
+      : num_particles(0), num_edeps(0), traj_id(nullptr)
+      , x(nullptr), y(nullptr), z(nullptr), t(nullptr), e(nullptr), dedx(nullptr), offsets(nullptr)
+    {}
+
+    size_t num_particles;   ///< rows of the particle columns
+    size_t num_edeps;       ///< rows of the EDep columns
+
+    const int64_t* traj_id;                           ///< Geant4 track id of each particle
+    std::map<std::string, const int64_t*> int_columns;  ///< optional integer particle columns by name
+    std::map<std::string, const double*> float_columns; ///< optional float particle columns by name
+
+    const double *x, *y, *z, *t, *e, *dedx; ///< EDep columns (t and dedx optional)
+    const int64_t* offsets;                 ///< num_particles+1 EDep row offsets
+  };
+
+  /// Build an EventInput from its columns in one pass (throws on inconsistent offsets)
+  EventInput MakeEventInput(const EventInputColumns& columns);
+}
+
+#endif  // __SUPERA_EVENTCOLUMNS_H__
@@ -212,7 +212,100 @@ namespace supera {
   }
 
 
-  VoxelSet ImageMeta3D::edep2voxelset(const std::vector<supera::EDep> edeps) const
+  VoxelBounds ImageMeta3D::bounds(const VoxelSet& vs) const
+  {
+    VoxelBounds result;
+    size_t x, y, z;
+    for(auto const& id : vs.ids()) {
+      this->id_to_xyz_index(id, x, y, z);
+      result.extend(x, y, z);
+    }
+    return result;
+  }
+
+  // Neighbor row (fixed y/z offset) scanned by ImageMeta3D::touching, with its cursor into the probed set
+  struct TouchRow_t {
+    long dy, dz;
+    size_t cursor;
+  };
+
+  // Advance cursor to the first element of ids that is >= key. Keys are queried in
+  // increasing order, so galloping from the previous position keeps the scan near-linear.
+  static inline size_t GallopTo(const std::vector<VoxelID_t>& ids, size_t cursor, VoxelID_t key)
+  {
+    if(cursor >= ids.size() || ids[cursor] >= key) return cursor;
+    size_t step = 1;
+    size_t lo = cursor;
+    while(lo + step < ids.size() && ids[lo + step] < key) {
+      lo += step;
+      step *= 2;
+    }
+    size_t hi = std::min(lo + step + 1, ids.size());
+    return std::lower_bound(ids.begin() + lo + 1, ids.begin() + hi, key) - ids.begin();
+  }
+
+  // For each voxel of small (in order), the candidates of large on a given (dy,dz) row form the
+  // contiguous id range [x-distance, x+distance] of that row, so every row needs one cursor
+  // and a single comparison against the range end.
+  template <class Rows>
+  static bool TouchScan(const std::vector<VoxelID_t>& small, const std::vector<VoxelID_t>& large,
+    Rows& rows, size_t distance, size_t xnum, size_t ynum, size_t znum)
+  {
+    const size_t plane = xnum * ynum;
+    for(auto const& id : small) {
+      const size_t z = id / plane;
+      const size_t rem = id - z * plane;
+      const size_t y = rem / xnum;
+      const size_t x = rem - y * xnum;
+      const size_t xlo = (x < distance ? 0 : x - distance);
+      const size_t xhi = std::min(x + distance, xnum - 1);
+      for(auto& row : rows) {
+        const long ny = (long)(y) + row.dy;
+        const long nz = (long)(z) + row.dz;
+        if(ny < 0 || nz < 0 || ny >= (long)(ynum) || nz >= (long)(znum)) continue;
+        const VoxelID_t base = (size_t)(nz) * plane + (size_t)(ny) * xnum;
+        row.cursor = GallopTo(large, row.cursor, base + xlo);
+        if(row.cursor >= large.size()) continue;
+        if(large[row.cursor] <= base + xhi) return true;
+      }
+    }
+    return false;
+  }
+
+  bool ImageMeta3D::touching(const VoxelSet& vs1, const VoxelSet& vs2, size_t distance) const
+  {
+    if(!vs1.size() || !vs2.size()) return false;
+    auto const& small = (vs1.size() < vs2.size() ? vs1.ids() : vs2.ids());
+    auto const& large = (vs1.size() < vs2.size() ? vs2.ids() : vs1.ids());
+    if(large.back() >= _num_element) throw meatloaf("ImageMeta3D::touching invalid VoxelID_t!");
+    if(small.back() >= _num_element) throw meatloaf("ImageMeta3D::touching invalid VoxelID_t!");
+
+    // Early reject: ids are sorted with z as the slowest axis, so the z extent is free
+    const size_t plane = _xnum * _ynum;
+    const size_t small_zmin = small.front() / plane, small_zmax = small.back() / plane;
+    const size_t large_zmin = large.front() / plane, large_zmax = large.back() / plane;
+    if(small_zmin > large_zmax + distance || large_zmin > small_zmax + distance)
+      return false;
+
+    if(distance == 1) {
+      std::array<TouchRow_t,9> rows;
+      size_t idx = 0;
+      for(long dz = -1; dz <= 1; ++dz)
+        for(long dy = -1; dy <= 1; ++dy)
+          rows[idx++] = TouchRow_t{dy, dz, 0};
+      return TouchScan(small, large, rows, 1, _xnum, _ynum, _znum);
+    }
+
+    std::vector<TouchRow_t> rows;
+    const long d = (long)(distance);
+    rows.reserve((2 * distance + 1) * (2 * distance + 1));
+    for(long dz = -d; dz <= d; ++dz)
+      for(long dy = -d; dy <= d; ++dy)
+        rows.push_back(TouchRow_t{dy, dz, 0});
+    return TouchScan(small, large, rows, distance, _xnum, _ynum, _znum);
+  }
+
+  VoxelSet ImageMeta3D::edep2voxelset(const std::vector<supera::EDep>& edeps) const
   {
     VoxelSet result;
     result.reserve(edeps.size());
@@ -220,8 +313,9 @@ namespace supera {
       auto vox_id = this->id(edep.x,edep.y,edep.z);
       if(vox_id == supera::kINVALID_VOXELID)
         continue;
-      result.emplace(vox_id, edep.e, true);
+      result.stage(vox_id, edep.e);
     }
+    result.finalize(true);
     return result;
   }
 
@@ -16,6 +16,7 @@
 #include "supera/base/SuperaType.h"
 #include "supera/base/BBox.h"
 #include "supera/base/Voxel.h"
+#include "supera/base/VoxelBounds.h"
 #include <array>
 
 namespace supera {
@@ -110,7 +111,13 @@ namespace supera {
     void id_to_xyz_index(VoxelID_t id, size_t& x, size_t& y, size_t& z) const;
 
     // Utility function to convert a vector of EDep to VoxelSet
-    VoxelSet edep2voxelset(const std::vector<supera::EDep> edeps) const;
+    VoxelSet edep2voxelset(const std::vector<supera::EDep>& edeps) const;
+
+    // Voxel index bounds of a VoxelSet
+    VoxelBounds bounds(const VoxelSet& vs) const;
+
+    // Check if any voxel of vs1 is within distance (in voxel counts along every axis) of a voxel in vs2
+    bool touching(const VoxelSet& vs1, const VoxelSet& vs2, size_t distance) const;
 
   private:
 
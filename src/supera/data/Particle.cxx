@@ -234,10 +234,10 @@ namespace supera {
       throw meatloaf();
     }
     
-    for(auto const& vox : child.energy.as_vector())
-      this->energy.emplace(vox.id(),vox.value(),true);
-    for(auto const& vox : child.dedx.as_vector())
-      this->dedx.emplace(vox.id(),vox.value(),true);
+    // Both sets are sorted: linear merge (or a plain move if this one is empty)
+    this->energy.emplace(std::move(child.energy),true);
+    this->dedx.emplace(std::move(child.dedx),true);
+    this->bounds.extend(child.bounds);
     
     if(verbose) {
       std::cout<<"Parent track id " << this->part.trackid
@@ -252,9 +252,6 @@ namespace supera {
       //std::cout<<child.dump2cpp()<<std::endl;
       this->UpdateLastPoint(child.last_pt);
     }
-    this->merged_v.push_back(child.part.trackid);
-    for(auto const& trackid : child.merged_v)
-      this->merged_v.push_back(trackid);
     /*
     for(size_t plane_id=0; plane_id < vs2d_v.size(); ++plane_id) {
       auto& vs2d = vs2d_v[plane_id];
@@ -266,6 +263,7 @@ namespace supera {
     */
     child.energy.clear_data();
     child.dedx.clear_data();
+    child.bounds.clear();
     child.valid=false;
     child.merge_id=this->part.trackid;
   }
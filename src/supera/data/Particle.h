@@ -20,6 +20,7 @@
 #include "supera/base/Point.h"
 #include "supera/base/SuperaType.h"
 #include "supera/base/Voxel.h"
+#include "supera/base/VoxelBounds.h"
 
 namespace supera {
 
@@ -196,11 +197,12 @@ namespace supera {
 
       supera::Particle part;            ///< a particle information
       bool valid;                       ///< a state flag whether this particle should be ignored or not
-      std::vector <TrackID_t> merged_v;  ///< track ID of descendent particles that are merged
+      std::vector <TrackID_t> merged_v;  ///< track ID of descendent particles that are merged (filled by the label algorithm at output time)
       std::vector <TrackID_t> parent_trackid_v; ///< track ID of parent particles in the history
       TrackID_t merge_id;               ///< a track ID of the particle to which this one is merged
       supera::VoxelSet energy;          ///< 3D voxels (energy deposition)
       supera::VoxelSet dedx;            ///< 3D voxels (dE/dX)
+      supera::VoxelBounds bounds;       ///< voxel index bounds of energy (grown by Merge, may be loose after thresholding)
       EDep first_pt;                    ///< first energy deposition point (not voxel)
       EDep last_pt;                     ///< last energy deposition point (not voxel)
   };
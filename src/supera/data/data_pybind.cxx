@@ -2,16 +2,53 @@
 
 #include "data_pybind.h"
 
+#include "pybind11/numpy.h"
 #include "pybind11/operators.h"
 #include "pybind11/stl.h"
 
 #include "supera/pybind_mkdoc.h"
 
 #include "Event.h"
+#include "EventColumns.h"
 #include "ImageMeta3D.h"
 #include "Particle.h"
 #include "TriggerMeta.h"
 
+namespace
+{
+  /// Hand a std::vector's buffer over to numpy without copying: the vector is moved onto the heap and owned by a capsule
+  template <typename T>
+  pybind11::array_t<T> move_to_numpy(std::vector<T>&& v)
+  {
+    auto owner = new std::vector<T>(std::move(v));
+    pybind11::capsule base(owner, [](void* p) { delete reinterpret_cast<std::vector<T>*>(p); });
+    return pybind11::array_t<T>(owner->size(), owner->data(), base);
+  }
+
+  /// CSR cluster export shared by EventOutput.ClustersEnergy() and EventOutput.ClustersdEdX()
+  template <typename FillFn>
+  pybind11::tuple clusters_to_numpy(const supera::EventOutput& self, FillFn fill, bool fill_unassociated)
+  {
+    std::vector<supera::VoxelID_t> ids;
+    std::vector<float> values;
+    std::vector<size_t> offsets;
+    (self.*fill)(ids, values, offsets, fill_unassociated);
+    return pybind11::make_tuple(move_to_numpy(std::move(ids)),
+                                move_to_numpy(std::move(values)),
+                                move_to_numpy(std::move(offsets)));
+  }
+
+  /// Tensor export shared by EventOutput.TensorEnergy() and EventOutput.TensorSemantic()
+  pybind11::tuple tensor_to_numpy(const supera::EventOutput& self,
+                                  void (supera::EventOutput::*fill)(std::vector<supera::VoxelID_t>&, std::vector<float>&) const)
+  {
+    std::vector<supera::VoxelID_t> ids;
+    std::vector<float> values;
+    (self.*fill)(ids, values);
+    return pybind11::make_tuple(move_to_numpy(std::move(ids)), move_to_numpy(std::move(values)));
+  }
+}
+
 void init_data(pybind11::module& m)
 {
   using namespace pybind11::literals;
@@ -56,7 +93,9 @@ void init_data(pybind11::module& m)
       .def("id_to_y_index", &supera::ImageMeta3D::id_to_y_index, DOC(supera, ImageMeta3D, id_to_y_index), "id"_a)
       .def("id_to_z_index", &supera::ImageMeta3D::id_to_z_index, DOC(supera, ImageMeta3D, id_to_z_index), "id"_a)
       .def("id_to_xyz_index", &supera::ImageMeta3D::id_to_xyz_index, DOC(supera, ImageMeta3D, id_to_xyz_index),
-           "id"_a, "x"_a, "y"_a, "z"_a);
+           "id"_a, "x"_a, "y"_a, "z"_a)
+      .def("touching", &supera::ImageMeta3D::touching, DOC(supera, ImageMeta3D, touching),
+           "vs1"_a, "vs2"_a, "distance"_a);
 
   // ----------------------------------------------------------------------
 
@@ -106,6 +145,82 @@ void init_data(pybind11::module& m)
       .def_readwrite("pcloud", &supera::ParticleInput::pcloud, DOC(supera, ParticleInput, pcloud))
       .def_readwrite("valid", &supera::ParticleInput::valid, DOC(supera, ParticleInput, valid));
 
+  using Int64Array_t = pybind11::array_t<int64_t, pybind11::array::c_style | pybind11::array::forcecast>;
+  using DoubleArray_t = pybind11::array_t<double, pybind11::array::c_style | pybind11::array::forcecast>;
+
+  pybind11::class_<supera::EventInput>(m, "EventInput", "Input particles of an event and the energy depositions not associated to any of them")
+      .def(pybind11::init<>())
+      .def("__len__", [](const supera::EventInput& self) { return self.size(); })
+      .def("__getitem__", [](supera::EventInput& self, size_t i) -> supera::ParticleInput&
+           {
+             if(i >= self.size()) throw pybind11::index_error();
+             return self[i];
+           }, pybind11::return_value_policy::reference_internal)
+      .def("append", [](supera::EventInput& self, const supera::ParticleInput& part) { self.push_back(part); })
+      .def_readwrite("unassociated_edeps", &supera::EventInput::unassociated_edeps, DOC(supera, EventInput, unassociated_edeps))
+
+      // columnar construction: the whole event is built in C++ from numpy columns in one call.
+      // particles maps column names (traj_id and type are required, see supera::kParticleIntColumns / kParticleFloatColumns)
+      // to 1-D arrays; EDeps of particle i are rows offsets[i]:offsets[i+1] of x/y/z/e (and t/dedx),
+      // rows from offsets[-1] on become unassociated_edeps.
+      .def_static("FromArrays", [](const pybind11::dict& particles,
+                                   const DoubleArray_t& x, const DoubleArray_t& y, const DoubleArray_t& z,
+                                   const DoubleArray_t& e, const Int64Array_t& offsets,
+                                   pybind11::object t, pybind11::object dedx)
+           {
+             supera::EventInputColumns columns;
+             columns.num_edeps = x.size();
+             if(offsets.ndim() != 1 || offsets.size() < 1)
+               throw std::invalid_argument("offsets must be a 1-D array with one entry more than there are particles");
+             columns.num_particles = offsets.size() - 1;
+             for(auto const* col : {&y, &z, &e})
+               if((size_t)col->size() != columns.num_edeps)
+                 throw std::invalid_argument("EDep columns x, y, z and e must have the same length");
+
+             // keep converted arrays alive until the event is built
+             std::vector<Int64Array_t> int_keep;
+             std::vector<DoubleArray_t> float_keep;
+             int_keep.reserve(particles.size() + 1);
+             float_keep.reserve(particles.size() + 2);
+             auto as_int = [&](pybind11::handle obj) {
+               int_keep.push_back(Int64Array_t::ensure(obj));
+               if(!int_keep.back() || (size_t)int_keep.back().size() != columns.num_particles)
+                 throw std::invalid_argument("particle columns must be 1-D arrays with one entry per particle");
+               return int_keep.back().data();
+             };
+             auto as_double = [&](pybind11::handle obj, size_t rows) {
+               float_keep.push_back(DoubleArray_t::ensure(obj));
+               if(!float_keep.back() || (size_t)float_keep.back().size() != rows)
+                 throw std::invalid_argument("column length does not match the table it belongs to");
+               return float_keep.back().data();
+             };
+
+             if(!particles.contains("traj_id"))
+               throw std::invalid_argument("particles must contain a traj_id column");
+             columns.traj_id = as_int(particles["traj_id"]);
+             for(size_t c=0; c<supera::kNumParticleIntColumns; ++c) {
+               auto name = supera::kParticleIntColumns[c].name;
+               if(particles.contains(name)) columns.int_columns[name] = as_int(particles[name]);
+             }
+             for(size_t c=0; c<supera::kNumParticleFloatColumns; ++c) {
+               auto name = supera::kParticleFloatColumns[c].name;
+               if(particles.contains(name)) columns.float_columns[name] = as_double(particles[name], columns.num_particles);
+             }
+
+             columns.x = x.data();
+             columns.y = y.data();
+             columns.z = z.data();
+             columns.e = e.data();
+             columns.offsets = offsets.data();
+             if(!t.is_none()) columns.t = as_double(t, columns.num_edeps);
+             if(!dedx.is_none()) columns.dedx = as_double(dedx, columns.num_edeps);
+
+             pybind11::gil_scoped_release release;
+             return supera::MakeEventInput(columns);
+           },
+           DOC(supera, MakeEventInput),
+           "particles"_a, "x"_a, "y"_a, "z"_a, "e"_a, "offsets"_a, "t"_a=pybind11::none(), "dedx"_a=pybind11::none());
+
   pybind11::class_<supera::ParticleLabel>(m, "ParticleLabel", DOC(supera, ParticleLabel))
       // constructors
       .def(pybind11::init<>(), DOC(supera, ParticleLabel, ParticleLabel))
@@ -149,7 +264,29 @@ void init_data(pybind11::module& m)
       .def("VoxelDeDxs", &supera::EventOutput::VoxelDeDxs, DOC(supera, EventOutput, VoxelDeDxs))
       .def("VoxelEnergies", &supera::EventOutput::VoxelEnergies, DOC(supera, EventOutput, VoxelEnergies))
       .def("VoxelLabels", &supera::EventOutput::VoxelLabels, DOC(supera, EventOutput, VoxelLabels), "semanticPriority"_a)
-      .def("dump2cpp", &supera::EventOutput::dump2cpp, DOC(supera, EventOutput, dump2cpp), "instanceName"_a="evtOutput");
+      .def("dump2cpp", &supera::EventOutput::dump2cpp, DOC(supera, EventOutput, dump2cpp), "instanceName"_a="evtOutput")
+
+      // numpy exports of the label tensors.
+      // tensors are (ids, values); clusters are (ids, values, offsets) in CSR form, where cluster i is ids[offsets[i]:offsets[i+1]].
+      // all arrays own their buffers, so they stay valid after the EventOutput changes (e.g. the next Driver::Generate).
+      .def("TensorEnergy", [](const supera::EventOutput& self) { return tensor_to_numpy(self, &supera::EventOutput::FillTensorEnergy); },
+           "Voxel (ids, energies) of the event as numpy arrays")
+      .def("TensorSemantic", [](const supera::EventOutput& self) { return tensor_to_numpy(self, &supera::EventOutput::FillTensorSemantic); },
+           "Voxel (ids, semantic labels) of the event as numpy arrays")
+      .def("ClustersEnergy", [](const supera::EventOutput& self, bool fill_unassociated)
+           {
+             using Fill_t = void (supera::EventOutput::*)(std::vector<supera::VoxelID_t>&, std::vector<float>&,
+                                                          std::vector<size_t>&, bool) const;
+             return clusters_to_numpy(self, static_cast<Fill_t>(&supera::EventOutput::FillClustersEnergy), fill_unassociated);
+           }, "Per-particle energy clusters (then the unassociated voxels) as CSR numpy arrays (ids, values, offsets)",
+           "fill_unassociated"_a=true)
+      .def("ClustersdEdX", [](const supera::EventOutput& self, bool fill_unassociated)
+           {
+             using Fill_t = void (supera::EventOutput::*)(std::vector<supera::VoxelID_t>&, std::vector<float>&,
+                                                          std::vector<size_t>&, bool) const;
+             return clusters_to_numpy(self, static_cast<Fill_t>(&supera::EventOutput::FillClustersdEdX), fill_unassociated);
+           }, "Per-particle dE/dX clusters (then the unassociated voxels, with zero dE/dX) as CSR numpy arrays (ids, values, offsets)",
+           "fill_unassociated"_a=true);
     
   // ----------------------------------------------------------------------
 
@@ -0,0 +1,245 @@
+#ifndef __SUPERA_BINARYEVENTFILE_CXX__
+#define __SUPERA_BINARYEVENTFILE_CXX__
+
+#include "BinaryEventFile.h"
+#include "supera/base/meatloaf.h"
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace supera {
+
+  namespace {
+
+    /// Sub-range of a pool, checked against its size
+    template <class T>
+    binary::ArrayView<T> Slice(const binary::ArrayView<T>& pool, uint64_t offset, uint64_t count)
+    {
+      if(offset > pool.size() || count > pool.size() - offset)
+        throw meatloaf("BinaryEventFile: reference out of range (corrupt file?)");
+      binary::ArrayView<T> result;
+      result.data = pool.data + offset;
+      result.count = count;
+      return result;
+    }
+
+    inline Vertex ToVertex(const binary::VertexRecord& r)
+    { return Vertex(r.x, r.y, r.z, r.t); }
+
+    inline EDep ToEDep(const binary::EDepRecord& r)
+    {
+      EDep pt;
+      pt.x = r.x; pt.y = r.y; pt.z = r.z;
+      pt.t = r.t; pt.e = r.e; pt.dedx = r.dedx;
+      return pt;
+    }
+
+    void ToEDeps(const binary::ArrayView<binary::EDepRecord>& records, std::vector<EDep>& pts)
+    {
+      pts.resize(records.size());
+      for(size_t i=0; i<records.size(); ++i) pts[i] = ToEDep(records[i]);
+    }
+
+    Particle ToParticle(const binary::ParticleRecord& r, const BinaryEventView& view)
+    {
+      Particle p;
+      p.id = r.id;
+      p.trackid = r.trackid;
+      p.genid = r.genid;
+      p.px = r.px; p.py = r.py; p.pz = r.pz;
+      p.end_px = r.end_px; p.end_py = r.end_py; p.end_pz = r.end_pz;
+      p.vtx = ToVertex(r.vtx);
+      p.end_pt = ToVertex(r.end_pt);
+      p.first_step = ToVertex(r.first_step);
+      p.last_step = ToVertex(r.last_step);
+      p.dist_travel = r.dist_travel;
+      p.energy_init = r.energy_init;
+      p.energy_deposit = r.energy_deposit;
+      p.parent_trackid = r.parent_trackid;
+      p.parent_vtx = ToVertex(r.parent_vtx);
+      p.ancestor_trackid = r.ancestor_trackid;
+      p.ancestor_vtx = ToVertex(r.ancestor_vtx);
+      p.parent_id = r.parent_id;
+      p.ancestor_id = r.ancestor_id;
+      p.group_id = r.group_id;
+      p.interaction_id = r.interaction_id;
+      p.process = view.str(r.process);
+      p.parent_process = view.str(r.parent_process);
+      p.ancestor_process = view.str(r.ancestor_process);
+      auto children = view.ids(r.children_id);
+      p.children_id.assign(children.begin(), children.end());
+      p.type = (ProcessType_t)(r.type);
+      p.shape = (SemanticType_t)(r.shape);
+      p.pdg = r.pdg;
+      p.parent_pdg = r.parent_pdg;
+      p.ancestor_pdg = r.ancestor_pdg;
+      return p;
+    }
+
+    void ToVoxelSet(const BinaryEventView& view, const binary::VoxelSpan& span, VoxelSet& vs)
+    {
+      auto ids = view.voxel_ids(span);
+      auto values = view.voxel_values(span);
+      vs.assign(ids.data, values.data, span.count);
+    }
+  }
+
+  // --------------------------------------------------------
+
+  BinaryEventView::BinaryEventView(const char* payload, size_t size)
+  : _payload(payload)
+  , _size(size)
+  , _header(reinterpret_cast<const binary::EventHeader*>(payload))
+  {
+    if(size < sizeof(binary::EventHeader) || reinterpret_cast<uintptr_t>(payload) % 8)
+      throw meatloaf("BinaryEventView: invalid event payload");
+  }
+
+  std::string BinaryEventView::str(const binary::Array& array) const
+  {
+    auto chars = Slice(this->array<char>(_header->chars), array.offset, array.count);
+    return std::string(chars.begin(), chars.end());
+  }
+
+  std::string BinaryEventView::name() const
+  { return str(_header->name); }
+
+  binary::ArrayView<binary::EDepRecord> BinaryEventView::pcloud(const binary::InputParticleRecord& particle) const
+  { return Slice(this->array<binary::EDepRecord>(_header->input_edeps), particle.pcloud.offset, particle.pcloud.count); }
+
+  binary::ArrayView<uint64_t> BinaryEventView::voxel_ids(const binary::VoxelSpan& span) const
+  { return Slice(this->array<uint64_t>(_header->voxel_ids), span.start, span.count); }
+
+  binary::ArrayView<float> BinaryEventView::voxel_values(const binary::VoxelSpan& span) const
+  { return Slice(this->array<float>(_header->voxel_values), span.start, span.count); }
+
+  binary::ArrayView<uint64_t> BinaryEventView::ids(const binary::Array& array) const
+  { return Slice(this->array<uint64_t>(_header->ids), array.offset, array.count); }
+
+  // --------------------------------------------------------
+
+  void BinaryEventFile::Open(const std::string& file_name)
+  {
+    this->Close();
+
+    int fd = ::open(file_name.c_str(), O_RDONLY);
+    if(fd < 0) throw meatloaf("BinaryEventFile: could not open " + file_name);
+    struct stat st;
+    if(::fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(binary::FileHeader)) {
+      ::close(fd);
+      throw meatloaf("BinaryEventFile: " + file_name + " is not a supera binary event file");
+    }
+    void* data = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if(data == MAP_FAILED) throw meatloaf("BinaryEventFile: could not map " + file_name);
+    _data = static_cast<const char*>(data);
+    _size = st.st_size;
+
+    auto const& header = *reinterpret_cast<const binary::FileHeader*>(_data);
+    std::string error;
+    if(std::memcmp(header.magic, binary::kMagic, sizeof(header.magic)))
+      error = " is not a supera binary event file";
+    else if(header.byte_order != binary::kByteOrder)
+      error = " was written with a different byte order";
+    else if(header.version != binary::kVersion)
+      error = " has format version " + std::to_string(header.version)
+        + " (expected " + std::to_string(binary::kVersion) + ")";
+    else if(header.index_offset % 8 || header.index_offset > _size
+      || header.num_events > (_size - header.index_offset) / sizeof(binary::EventIndex))
+      error = " has a corrupt event index";
+    if(!error.empty()) {
+      this->Close();
+      throw meatloaf("BinaryEventFile: " + file_name + error);
+    }
+    _index = reinterpret_cast<const binary::EventIndex*>(_data + header.index_offset);
+    _num_events = header.num_events;
+  }
+
+  void BinaryEventFile::Close()
+  {
+    if(_data) ::munmap(const_cast<char*>(_data), _size);
+    _data = nullptr;
+    _size = 0;
+    _index = nullptr;
+    _num_events = 0;
+  }
+
+  BinaryEventView BinaryEventFile::View(size_t entry) const
+  {
+    if(entry >= _num_events)
+      throw meatloaf("BinaryEventFile: entry " + std::to_string(entry) + " out of range");
+    auto const& index = _index[entry];
+    if(index.offset > _size || index.size > _size - index.offset)
+      throw meatloaf("BinaryEventFile: entry " + std::to_string(entry) + " out of range (corrupt file?)");
+    return BinaryEventView(_data + index.offset, index.size);
+  }
+
+  EventInput BinaryEventFile::Input(size_t entry) const
+  {
+    auto view = this->View(entry);
+    if(!view.has_input())
+      throw meatloaf("BinaryEventFile: entry " + std::to_string(entry) + " has no EventInput");
+
+    EventInput result;
+    auto particles = view.input_particles();
+    result.resize(particles.size());
+    for(size_t i=0; i<particles.size(); ++i) {
+      auto const& record = particles[i];
+      result[i].part = ToParticle(record.part, view);
+      result[i].valid = record.valid;
+      ToEDeps(view.pcloud(record), result[i].pcloud);
+    }
+    ToEDeps(view.unassociated_edeps(), result.unassociated_edeps);
+    return result;
+  }
+
+  ImageMeta3D BinaryEventFile::Meta(size_t entry) const
+  {
+    auto view = this->View(entry);
+    if(!view.has_meta())
+      throw meatloaf("BinaryEventFile: entry " + std::to_string(entry) + " has no ImageMeta3D");
+
+    ImageMeta3D result;
+    auto const& m = view.header().meta;
+    if(m.valid)
+      result.set(m.min_x, m.min_y, m.min_z, m.max_x, m.max_y, m.max_z,
+                 m.num_voxel_x, m.num_voxel_y, m.num_voxel_z);
+    return result;
+  }
+
+  EventOutput BinaryEventFile::Output(size_t entry) const
+  {
+    auto view = this->View(entry);
+    if(!view.has_output())
+      throw meatloaf("BinaryEventFile: entry " + std::to_string(entry) + " has no EventOutput");
+
+    EventOutput result;
+    auto labels = view.labels();
+    result._particles.resize(labels.size());
+    for(size_t i=0; i<labels.size(); ++i) {
+      auto const& record = labels[i];
+      auto& label = result._particles[i];
+      label.part = ToParticle(record.part, view);
+      label.valid = record.valid;
+      label.merge_id = record.merge_id;
+      auto merged = view.ids(record.merged_v);
+      label.merged_v.assign(merged.begin(), merged.end());
+      auto parents = view.ids(record.parent_trackid_v);
+      label.parent_trackid_v.assign(parents.begin(), parents.end());
+      ToVoxelSet(view, record.energy, label.energy);
+      ToVoxelSet(view, record.dedx, label.dedx);
+      label.first_pt = ToEDep(record.first_pt);
+      label.last_pt = ToEDep(record.last_pt);
+    }
+    auto const& header = view.header();
+    ToVoxelSet(view, header.energies, result._energies);
+    ToVoxelSet(view, header.semantics, result._semanticLabels);
+    ToVoxelSet(view, header.unassociated_voxels, result._unassociated_voxels);
+    return result;
+  }
+
+}
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * \file BinaryEventFile.h
+ *
+ * \ingroup io
+ *
+ * \brief Class def header for a class supera::BinaryEventFile
+ *
+ */
+
+/** \addtogroup io
+    @{*/
+#ifndef __SUPERA_BINARYEVENTFILE_H__
+#define __SUPERA_BINARYEVENTFILE_H__
+
+#include "supera/data/Event.h"
+#include "supera/data/ImageMeta3D.h"
+#include "supera/base/meatloaf.h"
+#include "BinaryEventFormat.h"
+
+namespace supera {
+
+  /**
+     \class BinaryEventView
+     @brief Typed access to one event payload of a mapped BinaryEventFile, valid while the file stays open. \n
+     Every array is bounds-checked when it is requested; the records themselves are not copied.
+  */
+  class BinaryEventView {
+  public:
+    BinaryEventView(const char* payload, size_t size);
+
+    inline const binary::EventHeader& header() const { return *_header; }
+    inline bool has_input()  const { return _header->flags & binary::kHasInput;  }
+    inline bool has_meta()   const { return _header->flags & binary::kHasMeta;   }
+    inline bool has_output() const { return _header->flags & binary::kHasOutput; }
+
+    std::string name() const;
+    /// Build a string stored in the chars pool
+    std::string str(const binary::Array& array) const;
+
+    inline binary::ArrayView<binary::InputParticleRecord> input_particles() const
+    { return array<binary::InputParticleRecord>(_header->input_particles); }
+    /// Energy depositions of an input particle
+    binary::ArrayView<binary::EDepRecord> pcloud(const binary::InputParticleRecord& particle) const;
+    inline binary::ArrayView<binary::EDepRecord> unassociated_edeps() const
+    { return array<binary::EDepRecord>(_header->unassociated_edeps); }
+
+    inline binary::ArrayView<binary::LabelRecord> labels() const
+    { return array<binary::LabelRecord>(_header->labels); }
+    /// Voxel ids and values of a span
+    binary::ArrayView<uint64_t> voxel_ids(const binary::VoxelSpan& span) const;
+    binary::ArrayView<float> voxel_values(const binary::VoxelSpan& span) const;
+    /// Elements of an array in the ids pool
+    binary::ArrayView<uint64_t> ids(const binary::Array& array) const;
+
+    /// Check and view an array of the payload
+    template <class T>
+    binary::ArrayView<T> array(const binary::Array& array) const;
+
+  private:
+    const char* _payload;
+    size_t _size;
+    const binary::EventHeader* _header;
+  };
+
+  template <class T>
+  binary::ArrayView<T> BinaryEventView::array(const binary::Array& array) const
+  {
+    if(array.offset % alignof(T) || array.offset > _size || array.count > (_size - array.offset) / sizeof(T))
+      throw meatloaf("BinaryEventView: array out of range (corrupt file?)");
+    binary::ArrayView<T> result;
+    result.data = reinterpret_cast<const T*>(_payload + array.offset);
+    result.count = array.count;
+    return result;
+  }
+
+  /**
+     \class BinaryEventFile
+     @brief Memory-maps a file written by BinaryEventWriter. Events are accessed in place through \n
+     BinaryEventView, or materialized into EventInput / ImageMeta3D / EventOutput with bulk copies.
+  */
+  class BinaryEventFile {
+  public:
+    BinaryEventFile() : _data(nullptr), _size(0), _index(nullptr), _num_events(0) {}
+    explicit BinaryEventFile(const std::string& file_name) : BinaryEventFile() { Open(file_name); }
+    ~BinaryEventFile() { Close(); }
+
+    BinaryEventFile(const BinaryEventFile&) = delete;
+    BinaryEventFile& operator=(const BinaryEventFile&) = delete;
+
+    /// Map a file and check its header and index
+    void Open(const std::string& file_name);
+    /// Unmap the file (invalidates all views)
+    void Close();
+    /// True between Open() and Close()
+    inline bool IsOpen() const { return _data != nullptr; }
+    /// Number of events in the file
+    inline size_t NumEvents() const { return _num_events; }
+
+    /// View of an event payload
+    BinaryEventView View(size_t entry) const;
+    /// Name of an event
+    inline std::string Name(size_t entry) const { return View(entry).name(); }
+
+    EventInput Input(size_t entry) const;
+    ImageMeta3D Meta(size_t entry) const;
+    EventOutput Output(size_t entry) const;
+
+  private:
+    const char* _data;
+    size_t _size;
+    const binary::EventIndex* _index;
+    size_t _num_events;
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,157 @@
+/**
+ * \file BinaryEventFormat.h
+ *
+ * \ingroup io
+ *
+ * \brief On-disk records of the supera binary event format
+ *
+ */
+
+/** \addtogroup io
+    @{*/
+#ifndef __SUPERA_BINARYEVENTFORMAT_H__
+#define __SUPERA_BINARYEVENTFORMAT_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace supera {
+
+  /**
+     Records of the binary event format written by BinaryEventWriter and memory-mapped by BinaryEventFile. \n
+     File: FileHeader, then the event payloads, then num_events EventIndex entries at index_offset. \n
+     Event payload: an EventHeader followed by the arrays it refers to. Every Array is an (offset, count) pair \n
+     relative to the start of its payload and 8-byte aligned, so records can be used in place. \n
+     All values are stored in the byte order of the writer (checked with FileHeader::byte_order). \n
+     Bump kVersion on any layout change.
+  */
+  namespace binary {
+
+    const char     kMagic[8]  = {'S','U','P','E','R','A','E','V'};
+    const uint32_t kVersion   = 1;
+    const uint32_t kByteOrder = 0x01020304;
+
+    /// EventHeader::flags
+    enum EventFlag_t : uint32_t {
+      kHasInput  = 1,
+      kHasMeta   = 2,
+      kHasOutput = 4
+    };
+
+    /// Range of elements: at a byte offset of the event payload for the EventHeader arrays, \n
+    /// at an element offset of the pool for references into EventHeader::ids / chars / input_edeps
+    struct Array {
+      uint64_t offset;
+      uint64_t count;
+    };
+
+    /// Range of voxels in EventHeader::voxel_ids / voxel_values
+    struct VoxelSpan {
+      uint64_t start;
+      uint64_t count;
+    };
+
+    struct EDepRecord {
+      double x, y, z, t, e, dedx;
+    };
+
+    struct VertexRecord {
+      double x, y, z, t;
+    };
+
+    struct MetaRecord {
+      double min_x, min_y, min_z;
+      double max_x, max_y, max_z;
+      uint64_t num_voxel_x, num_voxel_y, num_voxel_z;
+      uint64_t valid;
+    };
+
+    struct ParticleRecord {
+      uint64_t id, trackid, genid;
+      double px, py, pz, end_px, end_py, end_pz;
+      VertexRecord vtx, end_pt, first_step, last_step;
+      double dist_travel, energy_init, energy_deposit;
+      uint64_t parent_trackid;
+      VertexRecord parent_vtx;
+      uint64_t ancestor_trackid;
+      VertexRecord ancestor_vtx;
+      uint64_t parent_id, ancestor_id, group_id, interaction_id;
+      Array process, parent_process, ancestor_process; ///< into EventHeader::chars
+      Array children_id;                               ///< into EventHeader::ids
+      int32_t type, shape, pdg, parent_pdg, ancestor_pdg;
+      uint32_t reserved;
+    };
+
+    struct InputParticleRecord {
+      ParticleRecord part;
+      Array pcloud;    ///< into EventHeader::input_edeps
+      uint64_t valid;
+    };
+
+    struct LabelRecord {
+      ParticleRecord part;
+      uint64_t valid;
+      uint64_t merge_id;
+      Array merged_v;          ///< into EventHeader::ids
+      Array parent_trackid_v;  ///< into EventHeader::ids
+      VoxelSpan energy, dedx;
+      EDepRecord first_pt, last_pt;
+    };
+
+    struct EventHeader {
+      uint32_t flags;           ///< EventFlag_t bits
+      uint32_t reserved;
+      Array name;               ///< chars
+      MetaRecord meta;
+      // EventInput
+      Array input_particles;    ///< InputParticleRecord
+      Array input_edeps;        ///< EDepRecord, pcloud of all particles
+      Array unassociated_edeps; ///< EDepRecord
+      // EventOutput
+      Array labels;             ///< LabelRecord
+      VoxelSpan energies;       ///< EventOutput::_energies
+      VoxelSpan semantics;      ///< EventOutput::_semanticLabels
+      VoxelSpan unassociated_voxels;
+      Array voxel_ids;          ///< uint64_t
+      Array voxel_values;       ///< float
+      // shared pools
+      Array ids;                ///< uint64_t track/instance ids
+      Array chars;              ///< char, strings (not null-terminated)
+    };
+
+    struct EventIndex {
+      uint64_t offset;          ///< byte offset of the payload in the file
+      uint64_t size;            ///< payload size in bytes
+    };
+
+    struct FileHeader {
+      char magic[8];
+      uint32_t version;
+      uint32_t byte_order;
+      uint64_t num_events;
+      uint64_t index_offset;    ///< byte offset of the EventIndex array
+    };
+
+    static_assert(sizeof(ParticleRecord) % 8 == 0, "binary records must keep 8-byte alignment");
+    static_assert(sizeof(InputParticleRecord) % 8 == 0, "binary records must keep 8-byte alignment");
+    static_assert(sizeof(LabelRecord) % 8 == 0, "binary records must keep 8-byte alignment");
+    static_assert(sizeof(EventHeader) % 8 == 0, "binary records must keep 8-byte alignment");
+    static_assert(sizeof(FileHeader) % 8 == 0, "binary records must keep 8-byte alignment");
+
+    /// Read-only view of count elements of T (e.g. a record array inside a mapped file)
+    template <class T>
+    struct ArrayView {
+      const T* data = nullptr;
+      size_t count = 0;
+      inline size_t size() const { return count; }
+      inline bool empty() const { return count == 0; }
+      inline const T& operator[](size_t index) const { return data[index]; }
+      inline const T* begin() const { return data; }
+      inline const T* end() const { return data + count; }
+    };
+
+  }
+}
+
+#endif
+/** @} */ // end of doxygen group
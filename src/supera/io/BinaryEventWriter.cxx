@@ -0,0 +1,236 @@
+#ifndef __SUPERA_BINARYEVENTWRITER_CXX__
+#define __SUPERA_BINARYEVENTWRITER_CXX__
+
+#include "BinaryEventWriter.h"
+#include "supera/base/meatloaf.h"
+#include <cstring>
+#include <iostream>
+
+namespace supera {
+
+  namespace {
+
+    /// Column pools of one event payload
+    struct Pools_t {
+      std::vector<binary::InputParticleRecord> input_particles;
+      std::vector<binary::EDepRecord> input_edeps, unassociated_edeps;
+      std::vector<binary::LabelRecord> labels;
+      std::vector<uint64_t> voxel_ids;
+      std::vector<float> voxel_values;
+      std::vector<uint64_t> ids;
+      std::vector<char> chars;
+
+      binary::Array AddString(const std::string& str)
+      {
+        binary::Array result{chars.size(), str.size()};
+        chars.insert(chars.end(), str.begin(), str.end());
+        return result;
+      }
+
+      template <class T>
+      binary::Array AddIDs(const std::vector<T>& id_v)
+      {
+        binary::Array result{ids.size(), id_v.size()};
+        ids.insert(ids.end(), id_v.begin(), id_v.end());
+        return result;
+      }
+
+      binary::VoxelSpan AddVoxels(const VoxelSet& vs)
+      {
+        binary::VoxelSpan result{voxel_ids.size(), vs.size()};
+        voxel_ids.insert(voxel_ids.end(), vs.ids().begin(), vs.ids().end());
+        voxel_values.insert(voxel_values.end(), vs.values().begin(), vs.values().end());
+        return result;
+      }
+    };
+
+    inline binary::VertexRecord ToRecord(const Vertex& vtx)
+    { return binary::VertexRecord{vtx.pos.x, vtx.pos.y, vtx.pos.z, vtx.time}; }
+
+    inline binary::EDepRecord ToRecord(const EDep& pt)
+    { return binary::EDepRecord{pt.x, pt.y, pt.z, pt.t, pt.e, pt.dedx}; }
+
+    binary::ParticleRecord ToRecord(const Particle& p, Pools_t& pools)
+    {
+      binary::ParticleRecord r;
+      std::memset(&r, 0, sizeof(r));
+      r.id = p.id;
+      r.trackid = p.trackid;
+      r.genid = p.genid;
+      r.px = p.px; r.py = p.py; r.pz = p.pz;
+      r.end_px = p.end_px; r.end_py = p.end_py; r.end_pz = p.end_pz;
+      r.vtx = ToRecord(p.vtx);
+      r.end_pt = ToRecord(p.end_pt);
+      r.first_step = ToRecord(p.first_step);
+      r.last_step = ToRecord(p.last_step);
+      r.dist_travel = p.dist_travel;
+      r.energy_init = p.energy_init;
+      r.energy_deposit = p.energy_deposit;
+      r.parent_trackid = p.parent_trackid;
+      r.parent_vtx = ToRecord(p.parent_vtx);
+      r.ancestor_trackid = p.ancestor_trackid;
+      r.ancestor_vtx = ToRecord(p.ancestor_vtx);
+      r.parent_id = p.parent_id;
+      r.ancestor_id = p.ancestor_id;
+      r.group_id = p.group_id;
+      r.interaction_id = p.interaction_id;
+      r.process = pools.AddString(p.process);
+      r.parent_process = pools.AddString(p.parent_process);
+      r.ancestor_process = pools.AddString(p.ancestor_process);
+      r.children_id = pools.AddIDs(p.children_id);
+      r.type = p.type;
+      r.shape = p.shape;
+      r.pdg = p.pdg;
+      r.parent_pdg = p.parent_pdg;
+      r.ancestor_pdg = p.ancestor_pdg;
+      return r;
+    }
+
+    /// Append n elements to the payload at an 8-byte boundary
+    template <class T>
+    binary::Array Append(std::vector<char>& payload, const T* data, size_t n)
+    {
+      payload.resize((payload.size() + 7) / 8 * 8, 0);
+      binary::Array result{payload.size(), n};
+      if(n) {
+        const char* bytes = reinterpret_cast<const char*>(data);
+        payload.insert(payload.end(), bytes, bytes + n * sizeof(T));
+      }
+      return result;
+    }
+
+    template <class T>
+    inline binary::Array Append(std::vector<char>& payload, const std::vector<T>& data)
+    { return Append(payload, data.data(), data.size()); }
+  }
+
+  BinaryEventWriter::~BinaryEventWriter()
+  {
+    try { this->Close(); }
+    catch(const std::exception& e) { std::cerr << "BinaryEventWriter: failed to close: " << e.what() << std::endl; }
+  }
+
+  void BinaryEventWriter::Open(const std::string& file_name)
+  {
+    this->Close();
+    _file.open(file_name, std::ios::binary | std::ios::trunc);
+    if(!_file) throw meatloaf("BinaryEventWriter: could not create " + file_name);
+
+    // the header is rewritten with the event count and index offset by Close()
+    binary::FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    _offset = sizeof(header);
+    _index.clear();
+  }
+
+  void BinaryEventWriter::Close()
+  {
+    if(!IsOpen()) return;
+
+    binary::FileHeader header;
+    std::memcpy(header.magic, binary::kMagic, sizeof(header.magic));
+    header.version = binary::kVersion;
+    header.byte_order = binary::kByteOrder;
+    header.num_events = _index.size();
+    header.index_offset = _offset;
+
+    _file.write(reinterpret_cast<const char*>(_index.data()), _index.size() * sizeof(binary::EventIndex));
+    _file.seekp(0);
+    _file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    bool good = _file.good();
+    _file.close();
+    _index.clear();
+    if(!good) throw meatloaf("BinaryEventWriter: write error");
+  }
+
+  void BinaryEventWriter::Write(const std::string& name, const EventInput& input)
+  { this->WriteEvent(name, &input, nullptr, nullptr); }
+
+  void BinaryEventWriter::Write(const std::string& name, const ImageMeta3D& meta, const EventOutput& output)
+  { this->WriteEvent(name, nullptr, &meta, &output); }
+
+  void BinaryEventWriter::Write(const std::string& name, const EventInput& input,
+                                const ImageMeta3D& meta, const EventOutput& output)
+  { this->WriteEvent(name, &input, &meta, &output); }
+
+  void BinaryEventWriter::WriteEvent(const std::string& name, const EventInput* input,
+                                     const ImageMeta3D* meta, const EventOutput* output)
+  {
+    if(!IsOpen()) throw meatloaf("BinaryEventWriter: no file is open");
+
+    binary::EventHeader header;
+    std::memset(&header, 0, sizeof(header));
+    Pools_t pools;
+    header.name = pools.AddString(name);
+
+    if(meta) {
+      header.flags |= binary::kHasMeta;
+      auto& m = header.meta;
+      m.min_x = meta->min_x(); m.min_y = meta->min_y(); m.min_z = meta->min_z();
+      m.max_x = meta->max_x(); m.max_y = meta->max_y(); m.max_z = meta->max_z();
+      m.num_voxel_x = meta->num_voxel_x();
+      m.num_voxel_y = meta->num_voxel_y();
+      m.num_voxel_z = meta->num_voxel_z();
+      m.valid = meta->valid();
+    }
+
+    if(input) {
+      header.flags |= binary::kHasInput;
+      pools.input_particles.reserve(input->size());
+      for(auto const& particle : *input) {
+        binary::InputParticleRecord r;
+        r.part = ToRecord(particle.part, pools);
+        r.pcloud = binary::Array{pools.input_edeps.size(), particle.pcloud.size()};
+        r.valid = particle.valid;
+        for(auto const& pt : particle.pcloud) pools.input_edeps.push_back(ToRecord(pt));
+        pools.input_particles.push_back(r);
+      }
+      for(auto const& pt : input->unassociated_edeps) pools.unassociated_edeps.push_back(ToRecord(pt));
+    }
+
+    if(output) {
+      header.flags |= binary::kHasOutput;
+      auto const& labels = output->Particles();
+      pools.labels.reserve(labels.size());
+      for(auto const& label : labels) {
+        binary::LabelRecord r;
+        std::memset(&r, 0, sizeof(r));
+        r.part = ToRecord(label.part, pools);
+        r.valid = label.valid;
+        r.merge_id = label.merge_id;
+        r.merged_v = pools.AddIDs(label.merged_v);
+        r.parent_trackid_v = pools.AddIDs(label.parent_trackid_v);
+        r.energy = pools.AddVoxels(label.energy);
+        r.dedx = pools.AddVoxels(label.dedx);
+        r.first_pt = ToRecord(label.first_pt);
+        r.last_pt = ToRecord(label.last_pt);
+        pools.labels.push_back(r);
+      }
+      header.energies = pools.AddVoxels(output->_energies);
+      header.semantics = pools.AddVoxels(output->_semanticLabels);
+      header.unassociated_voxels = pools.AddVoxels(output->_unassociated_voxels);
+    }
+
+    // lay out the payload: the header first, patched once all offsets are known
+    _payload.assign(sizeof(header), 0);
+    header.input_particles    = Append(_payload, pools.input_particles);
+    header.input_edeps        = Append(_payload, pools.input_edeps);
+    header.unassociated_edeps = Append(_payload, pools.unassociated_edeps);
+    header.labels             = Append(_payload, pools.labels);
+    header.voxel_ids          = Append(_payload, pools.voxel_ids);
+    header.voxel_values       = Append(_payload, pools.voxel_values);
+    header.ids                = Append(_payload, pools.ids);
+    header.chars              = Append(_payload, pools.chars);
+    _payload.resize((_payload.size() + 7) / 8 * 8, 0);
+    std::memcpy(_payload.data(), &header, sizeof(header));
+
+    _file.write(_payload.data(), _payload.size());
+    if(!_file) throw meatloaf("BinaryEventWriter: write error");
+    _index.push_back(binary::EventIndex{_offset, _payload.size()});
+    _offset += _payload.size();
+  }
+
+}
+
+#endif
@@ -0,0 +1,62 @@
+/**
+ * \file BinaryEventWriter.h
+ *
+ * \ingroup io
+ *
+ * \brief Class def header for a class supera::BinaryEventWriter
+ *
+ */
+
+/** \addtogroup io
+    @{*/
+#ifndef __SUPERA_BINARYEVENTWRITER_H__
+#define __SUPERA_BINARYEVENTWRITER_H__
+
+#include "supera/data/Event.h"
+#include "supera/data/ImageMeta3D.h"
+#include "BinaryEventFormat.h"
+#include <fstream>
+
+namespace supera {
+
+  /**
+     \class BinaryEventWriter
+     @brief Writes named events (EventInput, ImageMeta3D and/or EventOutput) in the binary event format \n
+     (see BinaryEventFormat.h), to be memory-mapped back by BinaryEventFile.
+  */
+  class BinaryEventWriter {
+  public:
+    BinaryEventWriter() : _offset(0) {}
+    ~BinaryEventWriter();
+
+    BinaryEventWriter(const BinaryEventWriter&) = delete;
+    BinaryEventWriter& operator=(const BinaryEventWriter&) = delete;
+
+    /// Create (truncate) the output file
+    void Open(const std::string& file_name);
+    /// Write the event index and close the file
+    void Close();
+    /// True between Open() and Close()
+    inline bool IsOpen() const { return _file.is_open(); }
+    /// Number of events written since Open()
+    inline size_t NumEvents() const { return _index.size(); }
+
+    void Write(const std::string& name, const EventInput& input);
+    void Write(const std::string& name, const ImageMeta3D& meta, const EventOutput& output);
+    void Write(const std::string& name, const EventInput& input,
+               const ImageMeta3D& meta, const EventOutput& output);
+
+  private:
+    void WriteEvent(const std::string& name, const EventInput* input,
+                    const ImageMeta3D* meta, const EventOutput* output);
+
+    std::ofstream _file;
+    std::vector<binary::EventIndex> _index;
+    uint64_t _offset;            ///< current end of the file
+    std::vector<char> _payload;  ///< event payload buffer, reused
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
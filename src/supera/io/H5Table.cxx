@@ -0,0 +1,135 @@
+#ifndef __SUPERA_H5TABLE_CXX__
+#define __SUPERA_H5TABLE_CXX__
+
+#include "H5Table.h"
+#include "supera/base/meatloaf.h"
+
+namespace supera {
+
+  std::mutex& H5Mutex()
+  {
+    static std::mutex mtx;
+    return mtx;
+  }
+
+  void H5Table::create(hid_t parent, const std::string& name, size_t chunk, int deflate)
+  {
+    close();
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    _group = H5Gcreate2(parent, name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if(_group < 0) throw meatloaf("H5Table: could not create group " + name);
+    _chunk = chunk ? chunk : 1;
+    _deflate = deflate;
+  }
+
+  void H5Table::open(hid_t parent, const std::string& name)
+  {
+    close();
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    _group = H5Gopen2(parent, name.c_str(), H5P_DEFAULT);
+    if(_group < 0) throw meatloaf("H5Table: could not open group " + name);
+  }
+
+  void H5Table::close()
+  {
+    if(!is_open()) return;
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    for(auto& name_id : _column_m) H5Dclose(name_id.second);
+    _column_m.clear();
+    H5Gclose(_group);
+    _group = -1;
+  }
+
+  hid_t H5Table::dataset(const std::string& column, hid_t type, bool create) const
+  {
+    auto iter = _column_m.find(column);
+    if(iter != _column_m.end()) return iter->second;
+
+    hid_t dset = -1;
+    if(H5Lexists(_group, column.c_str(), H5P_DEFAULT) > 0)
+      dset = H5Dopen2(_group, column.c_str(), H5P_DEFAULT);
+    else if(create) {
+      hsize_t dim = 0, maxdim = H5S_UNLIMITED, chunk = _chunk;
+      hid_t space = H5Screate_simple(1, &dim, &maxdim);
+      hid_t plist = H5Pcreate(H5P_DATASET_CREATE);
+      H5Pset_chunk(plist, 1, &chunk);
+      if(_deflate > 0) {
+        H5Pset_shuffle(plist);
+        H5Pset_deflate(plist, _deflate);
+      }
+      dset = H5Dcreate2(_group, column.c_str(), type, space, H5P_DEFAULT, plist, H5P_DEFAULT);
+      H5Pclose(plist);
+      H5Sclose(space);
+    }
+    if(dset < 0) throw meatloaf("H5Table: could not access column " + column);
+    _column_m[column] = dset;
+    return dset;
+  }
+
+  bool H5Table::has(const std::string& column) const
+  {
+    if(!is_open()) return false;
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    return _column_m.count(column) || H5Lexists(_group, column.c_str(), H5P_DEFAULT) > 0;
+  }
+
+  size_t H5Table::size(const std::string& column) const
+  {
+    if(!is_open()) throw meatloaf("H5Table: not open");
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    hid_t space = H5Dget_space(this->dataset(column, -1, false));
+    hsize_t dim = 0;
+    H5Sget_simple_extent_dims(space, &dim, nullptr);
+    H5Sclose(space);
+    return dim;
+  }
+
+  void H5Table::append(const std::string& column, hid_t type, const void* data, size_t n)
+  {
+    if(!is_open()) throw meatloaf("H5Table: not open");
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    hid_t dset = this->dataset(column, type, true);
+    if(!n) return;
+
+    hid_t space = H5Dget_space(dset);
+    hsize_t offset = 0;
+    H5Sget_simple_extent_dims(space, &offset, nullptr);
+    H5Sclose(space);
+
+    hsize_t count = n, dim = offset + n;
+    herr_t status = H5Dset_extent(dset, &dim);
+    space = H5Dget_space(dset);
+    hid_t memspace = H5Screate_simple(1, &count, nullptr);
+    status |= H5Sselect_hyperslab(space, H5S_SELECT_SET, &offset, nullptr, &count, nullptr);
+    status |= H5Dwrite(dset, type, memspace, space, H5P_DEFAULT, data);
+    H5Sclose(memspace);
+    H5Sclose(space);
+    if(status < 0) throw meatloaf("H5Table: failed to append to column " + column);
+  }
+
+  void H5Table::read(const std::string& column, hid_t type, size_t offset, size_t n, void* data) const
+  {
+    if(!is_open()) throw meatloaf("H5Table: not open");
+    std::lock_guard<std::mutex> lock(H5Mutex());
+    hid_t dset = this->dataset(column, type, false);
+    if(!n) return;
+
+    hid_t space = H5Dget_space(dset);
+    hsize_t dim = 0;
+    H5Sget_simple_extent_dims(space, &dim, nullptr);
+    if(offset + n > dim) {
+      H5Sclose(space);
+      throw meatloaf("H5Table: rows [" + std::to_string(offset) + "," + std::to_string(offset+n)
+        + ") out of range for column " + column + " of size " + std::to_string(dim));
+    }
+    hsize_t start = offset, count = n;
+    hid_t memspace = H5Screate_simple(1, &count, nullptr);
+    herr_t status = H5Sselect_hyperslab(space, H5S_SELECT_SET, &start, nullptr, &count, nullptr);
+    status |= H5Dread(dset, type, memspace, space, H5P_DEFAULT, data);
+    H5Sclose(memspace);
+    H5Sclose(space);
+    if(status < 0) throw meatloaf("H5Table: failed to read column " + column);
+  }
+
+}
+#endif
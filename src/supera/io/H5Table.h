@@ -0,0 +1,92 @@
+/**
+ * \file H5Table.h
+ *
+ * \ingroup io
+ *
+ * \brief Class def header for a class supera::H5Table
+ *
+ */
+
+/** \addtogroup io
+    @{*/
+#ifndef __SUPERA_H5TABLE_H__
+#define __SUPERA_H5TABLE_H__
+
+#include <hdf5.h>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace supera {
+
+  /// Lock held around every HDF5 call made by supera (the HDF5 library may be built without thread safety)
+  std::mutex& H5Mutex();
+
+  /// HDF5 native type for a C++ scalar type
+  inline hid_t H5NativeType(const double*)   { return H5T_NATIVE_DOUBLE; }
+  inline hid_t H5NativeType(const float*)    { return H5T_NATIVE_FLOAT;  }
+  inline hid_t H5NativeType(const int8_t*)   { return H5T_NATIVE_INT8;   }
+  inline hid_t H5NativeType(const int16_t*)  { return H5T_NATIVE_INT16;  }
+  inline hid_t H5NativeType(const int32_t*)  { return H5T_NATIVE_INT32;  }
+  inline hid_t H5NativeType(const int64_t*)  { return H5T_NATIVE_INT64;  }
+  inline hid_t H5NativeType(const uint8_t*)  { return H5T_NATIVE_UINT8;  }
+  inline hid_t H5NativeType(const uint16_t*) { return H5T_NATIVE_UINT16; }
+  inline hid_t H5NativeType(const uint32_t*) { return H5T_NATIVE_UINT32; }
+  inline hid_t H5NativeType(const uint64_t*) { return H5T_NATIVE_UINT64; }
+
+  /**
+     \class H5Table
+     @brief A group of 1-D column datasets in an HDF5 file. \n
+     Columns written by this class are extendible, chunked and (optionally) deflate-compressed, \n
+     and are created on their first append. Reads go through hyperslab selections so only the \n
+     requested rows are decoded.
+  */
+  class H5Table {
+  public:
+    H5Table() : _group(-1), _chunk(0), _deflate(0) {}
+    ~H5Table() { close(); }
+
+    H5Table(const H5Table&) = delete;
+    H5Table& operator=(const H5Table&) = delete;
+
+    /// Create the group name under parent for writing: chunk is in rows, deflate in [0,9] (0 = no compression)
+    void create(hid_t parent, const std::string& name, size_t chunk, int deflate);
+    /// Open an existing group name under parent for reading
+    void open(hid_t parent, const std::string& name);
+    /// Close all datasets and the group
+    void close();
+    /// True if create() or open() succeeded and close() was not called
+    inline bool is_open() const { return _group >= 0; }
+    /// True if the column exists
+    bool has(const std::string& column) const;
+    /// Number of rows of a column
+    size_t size(const std::string& column) const;
+
+    /// Append n rows to a column (created with the given type if missing)
+    void append(const std::string& column, hid_t type, const void* data, size_t n);
+    /// Read n rows of a column starting at row offset into data, converting to type
+    void read(const std::string& column, hid_t type, size_t offset, size_t n, void* data) const;
+
+    template <class T>
+    inline void append(const std::string& column, const std::vector<T>& data)
+    { this->append(column, H5NativeType((const T*)nullptr), data.data(), data.size()); }
+
+    template <class T>
+    inline void read(const std::string& column, size_t offset, size_t n, std::vector<T>& data) const
+    { data.resize(n); this->read(column, H5NativeType((const T*)nullptr), offset, n, data.data()); }
+
+  private:
+    hid_t dataset(const std::string& column, hid_t type, bool create) const;
+
+    hid_t _group;   ///< HDF5 group id
+    size_t _chunk;  ///< chunk size in rows for new columns
+    int _deflate;   ///< deflate level for new columns
+    mutable std::map<std::string,hid_t> _column_m; ///< open column datasets
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
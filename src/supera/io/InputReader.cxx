@@ -0,0 +1,379 @@
+#ifndef __SUPERA_INPUTREADER_CXX__
+#define __SUPERA_INPUTREADER_CXX__
+
+#include "InputReader.h"
+#include "supera/base/meatloaf.h"
+#include "supera/data/EventColumns.h"
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+namespace supera {
+
+  namespace {
+    /// rows of event_id read at once while indexing
+    const size_t kIndexChunk = 1 << 20;
+  }
+
+  InputReader::InputReader(const std::string& name)
+  : Loggable(name)
+  , _read_ahead(16)
+  , _traj_table_name("mc_truth/trajectories")
+  , _seg_table_name("mc_truth/segments")
+  , _file(-1)
+  , _seg_has_t(false)
+  , _seg_has_dedx(false)
+  , _next_entry(0)
+  , _decode_entry(0)
+  , _stop(false)
+  {}
+
+  InputReader::~InputReader()
+  {
+    try { this->Close(); }
+    catch(const std::exception& e) { LOG_ERROR() << "failed to close the input: " << e.what() << std::endl; }
+  }
+
+  void InputReader::Configure(const YAML::Node& cfg)
+  {
+    if(IsOpen())
+      throw meatloaf("InputReader cannot be configured while a file is open");
+    if(cfg["LogLevel"])
+      this->SetLogConfig(supera::msg::parseStringThresh(cfg["LogLevel"].as<std::string>()));
+    if(cfg["ReadAhead"])
+      _read_ahead = cfg["ReadAhead"].as<size_t>();
+    if(cfg["TrajectoryTable"])
+      _traj_table_name = cfg["TrajectoryTable"].as<std::string>();
+    if(cfg["SegmentTable"])
+      _seg_table_name = cfg["SegmentTable"].as<std::string>();
+  }
+
+  void InputReader::Open(const std::string& file_name)
+  {
+    this->Close();
+    {
+      std::lock_guard<std::mutex> lock(H5Mutex());
+      _file = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    }
+    if(_file < 0) throw meatloaf("InputReader: could not open " + file_name);
+
+    try {
+      _traj_table.open(_file, _traj_table_name);
+      _seg_table.open(_file, _seg_table_name);
+
+      for(auto const& column : {"event_id", "traj_id"}) {
+        if(!_traj_table.has(column))
+          throw meatloaf("InputReader: " + _traj_table_name + " has no column " + column);
+      }
+      // type is the one required particle column, see kParticleIntColumns
+      if(!_traj_table.has("type"))
+        throw meatloaf("InputReader: " + _traj_table_name + " has no column type (ProcessType_t): "
+                       "derive it from the Geant4 start_process/start_subprocess columns when converting the file");
+      for(auto const& column : {"event_id", "traj_id", "x", "y", "z", "dE"}) {
+        if(!_seg_table.has(column))
+          throw meatloaf("InputReader: " + _seg_table_name + " has no column " + column);
+      }
+      _traj_int_columns.clear();
+      _traj_float_columns.clear();
+      for(size_t i=0; i<kNumParticleIntColumns; ++i)
+        if(_traj_table.has(kParticleIntColumns[i].name)) _traj_int_columns.push_back(i);
+      for(size_t i=0; i<kNumParticleFloatColumns; ++i)
+        if(_traj_table.has(kParticleFloatColumns[i].name)) _traj_float_columns.push_back(i);
+      _seg_has_t = _seg_table.has("t");
+      _seg_has_dedx = _seg_table.has("dEdx");
+
+      // combine the row ranges of both tables, ordered by event_id
+      std::map<int64_t, Entry_t> entry_m;
+      for(auto const& range : this->IndexTable(_traj_table)) {
+        auto& entry = entry_m[range.first];
+        entry.event_id = range.first;
+        entry.traj_start = range.second.first;
+        entry.traj_count = range.second.second;
+        entry.seg_start = entry.seg_count = 0;
+      }
+      for(auto const& range : this->IndexTable(_seg_table)) {
+        auto iter = entry_m.find(range.first);
+        if(iter == entry_m.end()) {
+          Entry_t entry;
+          entry.event_id = range.first;
+          entry.traj_start = entry.traj_count = 0;
+          iter = entry_m.emplace(range.first, entry).first;
+        }
+        iter->second.seg_start = range.second.first;
+        iter->second.seg_count = range.second.second;
+      }
+      _entries.clear();
+      _entries.reserve(entry_m.size());
+      for(auto const& id_entry : entry_m) _entries.push_back(id_entry.second);
+    }
+    catch(...) {
+      this->Close();
+      throw;
+    }
+
+    LOG_INFO() << "Reading " << _entries.size() << " events from " << file_name << std::endl;
+    this->StartReadAhead(0);
+  }
+
+  void InputReader::Close()
+  {
+    this->StopReadAhead();
+    _traj_table.close();
+    _seg_table.close();
+    if(IsOpen()) {
+      std::lock_guard<std::mutex> lock(H5Mutex());
+      H5Fclose(_file);
+    }
+    _file = -1;
+    _entries.clear();
+    _next_entry = 0;
+  }
+
+  int64_t InputReader::EventID(size_t entry) const
+  {
+    if(entry >= _entries.size())
+      throw meatloaf("InputReader: entry " + std::to_string(entry) + " out of range");
+    return _entries[entry].event_id;
+  }
+
+  std::vector<std::pair<int64_t, std::pair<size_t,size_t> > >
+  InputReader::IndexTable(const H5Table& table) const
+  {
+    std::vector<std::pair<int64_t, std::pair<size_t,size_t> > > result;
+    std::unordered_map<int64_t, size_t> seen_m;
+    std::vector<int64_t> event_id_v;
+    size_t num_rows = table.size("event_id");
+    for(size_t offset=0; offset<num_rows; offset+=kIndexChunk) {
+      size_t num = std::min(kIndexChunk, num_rows - offset);
+      table.read("event_id", offset, num, event_id_v);
+      for(size_t i=0; i<num; ++i) {
+        auto const& event_id = event_id_v[i];
+        if(result.size() && result.back().first == event_id) {
+          ++result.back().second.second;
+          continue;
+        }
+        if(!seen_m.emplace(event_id, result.size()).second)
+          throw meatloaf("InputReader: rows of event_id " + std::to_string(event_id) + " are not contiguous");
+        result.emplace_back(event_id, std::make_pair(offset + i, (size_t)1));
+      }
+    }
+    return result;
+  }
+
+  size_t InputReader::ContiguousEntries(size_t first, size_t max) const
+  {
+    // entries without rows in a table do not break the contiguity of that table
+    size_t traj_end = kINVALID_SIZE, seg_end = kINVALID_SIZE;
+    size_t num = 0;
+    for(size_t entry=first; entry<_entries.size() && num<max; ++entry, ++num) {
+      auto const& e = _entries[entry];
+      if(e.traj_count) {
+        if(traj_end != kINVALID_SIZE && e.traj_start != traj_end) break;
+        traj_end = e.traj_start + e.traj_count;
+      }
+      if(e.seg_count) {
+        if(seg_end != kINVALID_SIZE && e.seg_start != seg_end) break;
+        seg_end = e.seg_start + e.seg_count;
+      }
+    }
+    return std::max(num, (size_t)1);
+  }
+
+  void InputReader::Decode(size_t first, size_t last, std::vector<EventInput>& events) const
+  {
+    // row span of the block in both tables (the caller guarantees the rows are contiguous)
+    size_t traj_begin = kINVALID_SIZE, traj_rows = 0, seg_begin = kINVALID_SIZE, seg_rows = 0;
+    for(size_t entry=first; entry<last; ++entry) {
+      auto const& e = _entries[entry];
+      if(e.traj_count && traj_begin == kINVALID_SIZE) traj_begin = e.traj_start;
+      if(e.seg_count && seg_begin == kINVALID_SIZE) seg_begin = e.seg_start;
+      traj_rows += e.traj_count;
+      seg_rows += e.seg_count;
+    }
+
+    // trajectories: one hyperslab per column for the whole block
+    std::vector<Particle> part_v(traj_rows);
+    std::vector<int64_t> traj_id_v, int_v;
+    std::vector<double> float_v;
+    if(traj_rows) {
+      _traj_table.read("traj_id", traj_begin, traj_rows, traj_id_v);
+      for(auto const& column : _traj_int_columns) {
+        _traj_table.read(kParticleIntColumns[column].name, traj_begin, traj_rows, int_v);
+        for(size_t row=0; row<traj_rows; ++row) kParticleIntColumns[column].set(part_v[row], int_v[row]);
+      }
+      for(auto const& column : _traj_float_columns) {
+        _traj_table.read(kParticleFloatColumns[column].name, traj_begin, traj_rows, float_v);
+        for(size_t row=0; row<traj_rows; ++row) kParticleFloatColumns[column].set(part_v[row], float_v[row]);
+      }
+      for(size_t row=0; row<traj_rows; ++row) part_v[row].trackid = ColumnToTrackID(traj_id_v[row]);
+    }
+
+    // segments
+    std::vector<int64_t> seg_traj_id_v;
+    std::vector<double> x_v, y_v, z_v, t_v, de_v, dedx_v;
+    if(seg_rows) {
+      _seg_table.read("traj_id", seg_begin, seg_rows, seg_traj_id_v);
+      _seg_table.read("x", seg_begin, seg_rows, x_v);
+      _seg_table.read("y", seg_begin, seg_rows, y_v);
+      _seg_table.read("z", seg_begin, seg_rows, z_v);
+      _seg_table.read("dE", seg_begin, seg_rows, de_v);
+      if(_seg_has_t) _seg_table.read("t", seg_begin, seg_rows, t_v);
+      if(_seg_has_dedx) _seg_table.read("dEdx", seg_begin, seg_rows, dedx_v);
+    }
+
+    std::unordered_map<int64_t, size_t> traj_index_m;
+    for(size_t entry=first; entry<last; ++entry) {
+      auto const& e = _entries[entry];
+      events.emplace_back();
+      auto& event = events.back();
+
+      traj_index_m.clear();
+      event.resize(e.traj_count);
+      size_t traj_offset = e.traj_count ? e.traj_start - traj_begin : 0;
+      for(size_t i=0; i<e.traj_count; ++i) {
+        size_t row = traj_offset + i;
+        if(!traj_index_m.emplace(traj_id_v[row], i).second)
+          throw meatloaf("InputReader: duplicate traj_id " + std::to_string(traj_id_v[row])
+            + " in event_id " + std::to_string(e.event_id));
+        event[i].part = std::move(part_v[row]);
+      }
+
+      size_t seg_offset = e.seg_count ? e.seg_start - seg_begin : 0;
+      for(size_t i=0; i<e.seg_count; ++i) {
+        size_t row = seg_offset + i;
+        EDep pt;
+        pt.x = x_v[row];
+        pt.y = y_v[row];
+        pt.z = z_v[row];
+        pt.e = de_v[row];
+        if(_seg_has_t) pt.t = t_v[row];
+        if(_seg_has_dedx) pt.dedx = dedx_v[row];
+        auto iter = traj_index_m.find(seg_traj_id_v[row]);
+        if(iter == traj_index_m.end())
+          event.unassociated_edeps.push_back(pt);
+        else
+          event[iter->second].pcloud.push_back(pt);
+      }
+    }
+  }
+
+  EventInput InputReader::Read(size_t entry) const
+  {
+    if(entry >= _entries.size())
+      throw meatloaf("InputReader: entry " + std::to_string(entry) + " out of range");
+    std::vector<EventInput> events;
+    this->Decode(entry, entry + 1, events);
+    return std::move(events.front());
+  }
+
+  void InputReader::Seek(size_t entry)
+  {
+    if(!IsOpen()) throw meatloaf("InputReader: no file is open");
+    this->StopReadAhead();
+    this->StartReadAhead(std::min(entry, _entries.size()));
+  }
+
+  bool InputReader::Next(EventInput& event)
+  {
+    if(!IsOpen()) throw meatloaf("InputReader: no file is open");
+    if(_next_entry >= _entries.size()) return false;
+
+    if(!_read_ahead) {
+      event = this->Read(_next_entry++);
+      return true;
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(_queue_mtx);
+      _queue_cv.wait(lock, [this] { return !_queue.empty() || _reader_error; });
+      if(_queue.empty()) std::rethrow_exception(_reader_error);
+      event = std::move(_queue.front());
+      _queue.pop_front();
+    }
+    _queue_cv.notify_all();
+    ++_next_entry;
+    return true;
+  }
+
+  std::vector<EventInput> InputReader::NextBatch(size_t num)
+  {
+    if(!IsOpen()) throw meatloaf("InputReader: no file is open");
+    std::vector<EventInput> events;
+    num = std::min(num, _entries.size() - _next_entry);
+    events.reserve(num);
+
+    if(!_read_ahead) {
+      while(events.size() < num) {
+        size_t block = this->ContiguousEntries(_next_entry, num - events.size());
+        this->Decode(_next_entry, _next_entry + block, events);
+        _next_entry += block;
+      }
+      return events;
+    }
+
+    EventInput event;
+    while(events.size() < num && this->Next(event))
+      events.push_back(std::move(event));
+    return events;
+  }
+
+  void InputReader::StartReadAhead(size_t entry)
+  {
+    _next_entry = _decode_entry = entry;
+    _queue.clear();
+    _stop = false;
+    _reader_error = nullptr;
+    if(_read_ahead && _decode_entry < _entries.size())
+      _reader = std::thread(&InputReader::ReadAheadLoop, this);
+  }
+
+  void InputReader::StopReadAhead()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_queue_mtx);
+      _stop = true;
+    }
+    _queue_cv.notify_all();
+    if(_reader.joinable()) _reader.join();
+    _queue.clear();
+  }
+
+  void InputReader::ReadAheadLoop()
+  {
+    std::vector<EventInput> events;
+    while(true) {
+      size_t first, num;
+      {
+        // refill once half of the read-ahead has been consumed, so that blocks span several events
+        std::unique_lock<std::mutex> lock(_queue_mtx);
+        _queue_cv.wait(lock, [this] { return _stop || _queue.size() <= _read_ahead / 2; });
+        if(_stop) return;
+        first = _decode_entry;
+        num = _read_ahead - _queue.size();
+      }
+
+      events.clear();
+      try {
+        num = this->ContiguousEntries(first, num);
+        this->Decode(first, first + num, events);
+      }
+      catch(...) {
+        std::lock_guard<std::mutex> lock(_queue_mtx);
+        _reader_error = std::current_exception();
+        _queue_cv.notify_all();
+        return;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(_queue_mtx);
+        for(auto& event : events) _queue.push_back(std::move(event));
+        _decode_entry = first + num;
+      }
+      _queue_cv.notify_all();
+      if(_decode_entry >= _entries.size()) return;
+    }
+  }
+
+}
+
+#endif
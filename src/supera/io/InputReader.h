@@ -0,0 +1,119 @@
+/**
+ * \file InputReader.h
+ *
+ * \ingroup io
+ *
+ * \brief Class def header for a class supera::InputReader
+ *
+ */
+
+/** \addtogroup io
+    @{*/
+#ifndef __SUPERA_INPUTREADER_H__
+#define __SUPERA_INPUTREADER_H__
+
+#include "supera/base/Configurable.h"
+#include "supera/base/Loggable.h"
+#include "supera/data/Event.h"
+#include "H5Table.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <thread>
+
+namespace supera {
+
+  /**
+     \class InputReader
+     @brief Reads EventInput from flattened true particle and energy deposition tables in an HDF5 file. \n
+     The layout follows ND-LAr flow: each table is a group of 1-D columns, one row per trajectory \n
+     (TrajectoryTable, default "mc_truth/trajectories") or per segment (SegmentTable, default "mc_truth/segments"), \n
+     and rows are matched to events through their event_id column (rows of an event must be contiguous). \n
+     Trajectory columns (event_id, traj_id and type are required; missing ones keep the Particle defaults): \n
+       - integers: event_id, traj_id, parent_id, ancestor_id, pdg_id, gen_id, vertex_id (interaction_id), type (ProcessType_t) \n
+     Flow files only record the Geant4 start_process/start_subprocess, so type has to be added when converting them. \n
+       - floats  : E_start, px_start, py_start, pz_start, px_end, py_end, pz_end, \n
+                   x_start, y_start, z_start, t_start, x_end, y_end, z_end, t_end \n
+     Segment columns: event_id, traj_id, x, y, z, dE (required), t, dEdx (optional). \n
+     Segments whose traj_id does not match a trajectory of the event become unassociated_edeps. \n
+     Negative track ids (e.g. the parent_id of a primary) are read as kINVALID_TRACKID. \n
+     \n
+     Events are read by hyperslab, a block of consecutive events at a time, and a background thread keeps \n
+     the next ReadAhead events decoded (0 decodes synchronously in Next()).
+  */
+  class InputReader : public Loggable, public Configurable {
+  public:
+    InputReader(const std::string& name="InputReader");
+    ~InputReader();
+
+    InputReader(const InputReader&) = delete;
+    InputReader& operator=(const InputReader&) = delete;
+
+    void Configure(const YAML::Node& cfg) override;
+
+    /// Open a file and index its events
+    void Open(const std::string& file_name);
+    /// Stop reading and close the file
+    void Close();
+
+    /// True between Open() and Close()
+    inline bool IsOpen() const { return _file >= 0; }
+    /// Number of events in the file
+    inline size_t NumEvents() const { return _entries.size(); }
+    /// event_id of an entry
+    int64_t EventID(size_t entry) const;
+
+    /// Read a single entry directly (does not move the read-ahead position)
+    EventInput Read(size_t entry) const;
+    /// Restart sequential reading from entry
+    void Seek(size_t entry);
+    /// Next event in sequence, false when all events have been read
+    bool Next(EventInput& event);
+    /// Up to num next events in sequence (empty when all events have been read)
+    std::vector<EventInput> NextBatch(size_t num);
+
+  private:
+
+    /// Rows of one event in both tables
+    struct Entry_t {
+      int64_t event_id;
+      size_t traj_start, traj_count;
+      size_t seg_start, seg_count;
+    };
+
+    /// Row ranges [start,start+count) of every event_id in a table, in file order
+    std::vector<std::pair<int64_t, std::pair<size_t,size_t> > > IndexTable(const H5Table& table) const;
+    /// Decode entries [first,last) appending to events
+    void Decode(size_t first, size_t last, std::vector<EventInput>& events) const;
+    /// Number of entries from first (at most max) whose rows are contiguous in both tables
+    size_t ContiguousEntries(size_t first, size_t max) const;
+
+    void StartReadAhead(size_t entry);
+    void StopReadAhead();
+    void ReadAheadLoop();
+
+    size_t _read_ahead;
+    std::string _traj_table_name;
+    std::string _seg_table_name;
+
+    hid_t _file;
+    H5Table _traj_table, _seg_table;
+    std::vector<Entry_t> _entries;
+    std::vector<size_t> _traj_int_columns;   ///< optional integer trajectory columns present in the file
+    std::vector<size_t> _traj_float_columns; ///< optional float trajectory columns present in the file
+    bool _seg_has_t, _seg_has_dedx;
+
+    size_t _next_entry;                 ///< next entry returned by Next()
+    size_t _decode_entry;               ///< next entry to be decoded by the read-ahead thread
+    std::thread _reader;                ///< read-ahead thread
+    std::mutex _queue_mtx;
+    std::condition_variable _queue_cv;
+    std::deque<EventInput> _queue;      ///< decoded events waiting for Next()
+    bool _stop;                         ///< tells the read-ahead thread to finish
+    std::exception_ptr _reader_error;   ///< error raised by the read-ahead thread
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,315 @@
+#ifndef __SUPERA_OUTPUTWRITER_CXX__
+#define __SUPERA_OUTPUTWRITER_CXX__
+
+#include "OutputWriter.h"
+#include "supera/base/meatloaf.h"
+
+namespace supera {
+
+  struct OutputWriter::Batch_t {
+    size_t num_events = 0;
+    // events
+    std::vector<double> min_x, min_y, min_z, max_x, max_y, max_z;
+    std::vector<uint64_t> num_voxel_x, num_voxel_y, num_voxel_z;
+    std::vector<uint64_t> voxel_start, voxel_count;
+    std::vector<uint64_t> cluster_start, cluster_count;
+    std::vector<uint64_t> particle_start, particle_count;
+    // voxels
+    std::vector<uint64_t> voxel_id;
+    std::vector<float> voxel_energy;
+    std::vector<int16_t> voxel_semantic;
+    // clusters
+    std::vector<uint64_t> cluster_voxel_start, cluster_voxel_count;
+    // cluster_voxels
+    std::vector<uint64_t> cluster_voxel_id;
+    std::vector<float> cluster_voxel_energy;
+    // particles
+    std::vector<uint64_t> trackid, parent_trackid, ancestor_trackid;
+    std::vector<uint64_t> id, parent_id, ancestor_id, group_id, interaction_id;
+    std::vector<int32_t> pdg, parent_pdg, ancestor_pdg;
+    std::vector<int16_t> shape, type;
+    std::vector<double> energy_init, energy_deposit, px, py, pz;
+    std::vector<double> vtx_x, vtx_y, vtx_z, vtx_t;
+    std::vector<double> first_x, first_y, first_z, first_t;
+    std::vector<double> last_x, last_y, last_z, last_t;
+  };
+
+  OutputWriter::OutputWriter(const std::string& name)
+  : Loggable(name)
+  , _chunk_size(65536)
+  , _compression(4)
+  , _buffer_events(64)
+  , _file(-1)
+  , _num_events(0)
+  , _num_voxels(0)
+  , _num_clusters(0)
+  , _num_cluster_voxels(0)
+  , _num_particles(0)
+  , _stop(false)
+  {}
+
+  OutputWriter::~OutputWriter()
+  {
+    try { this->Close(); }
+    catch(const std::exception& e) { LOG_ERROR() << "failed to close the output: " << e.what() << std::endl; }
+  }
+
+  void OutputWriter::Configure(const YAML::Node& cfg)
+  {
+    if(IsOpen())
+      throw meatloaf("OutputWriter cannot be configured while a file is open");
+    if(cfg["LogLevel"])
+      this->SetLogConfig(supera::msg::parseStringThresh(cfg["LogLevel"].as<std::string>()));
+    if(cfg["ChunkSize"])
+      _chunk_size = cfg["ChunkSize"].as<size_t>();
+    if(cfg["Compression"])
+      _compression = cfg["Compression"].as<int>();
+    if(cfg["BufferEvents"])
+      _buffer_events = cfg["BufferEvents"].as<size_t>();
+    if(_compression < 0 || _compression > 9)
+      throw meatloaf("OutputWriter: Compression must be a deflate level in [0,9]");
+  }
+
+  void OutputWriter::Open(const std::string& file_name)
+  {
+    this->Close();
+    {
+      std::lock_guard<std::mutex> lock(H5Mutex());
+      _file = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    }
+    if(_file < 0) throw meatloaf("OutputWriter: could not create " + file_name);
+
+    _events.create(_file, "events", _chunk_size, _compression);
+    _voxels.create(_file, "voxels", _chunk_size, _compression);
+    _clusters.create(_file, "clusters", _chunk_size, _compression);
+    _cluster_voxels.create(_file, "cluster_voxels", _chunk_size, _compression);
+    _particles.create(_file, "particles", _chunk_size, _compression);
+
+    _num_events = _num_voxels = _num_clusters = _num_cluster_voxels = _num_particles = 0;
+    _batch.reset(new Batch_t);
+    _stop = false;
+    _writer_error = nullptr;
+    if(_buffer_events)
+      _writer = std::thread(&OutputWriter::WriterLoop, this);
+    LOG_INFO() << "Writing to " << file_name << std::endl;
+  }
+
+  void OutputWriter::Write(const ImageMeta3D& meta, const EventOutput& output)
+  {
+    if(!IsOpen()) throw meatloaf("OutputWriter: no file is open");
+    this->RethrowWriterError();
+
+    // build and check everything first: a failed Write must leave the batch columns aligned
+    // voxel tensors: energy and semantic labels share the voxel ids
+    std::vector<VoxelID_t> ids, semantic_ids;
+    std::vector<float> energies, semantics;
+    output.FillTensorEnergy(ids, energies);
+    output.FillTensorSemantic(semantic_ids, semantics);
+    if(ids != semantic_ids)
+      throw meatloaf("OutputWriter: energy and semantic tensors have different voxels");
+
+    // clusters: one per particle, then the unassociated voxels
+    std::vector<VoxelID_t> cluster_ids;
+    std::vector<float> cluster_energies;
+    std::vector<size_t> cluster_offsets;
+    output.FillClustersEnergy(cluster_ids, cluster_energies, cluster_offsets, true);
+    if(cluster_offsets.empty())
+      throw meatloaf("OutputWriter: cluster offsets are empty");
+
+    auto& b = *_batch;
+    b.min_x.push_back(meta.min_x()); b.min_y.push_back(meta.min_y()); b.min_z.push_back(meta.min_z());
+    b.max_x.push_back(meta.max_x()); b.max_y.push_back(meta.max_y()); b.max_z.push_back(meta.max_z());
+    b.num_voxel_x.push_back(meta.num_voxel_x());
+    b.num_voxel_y.push_back(meta.num_voxel_y());
+    b.num_voxel_z.push_back(meta.num_voxel_z());
+
+    b.voxel_start.push_back(_num_voxels);
+    b.voxel_count.push_back(ids.size());
+    b.voxel_id.insert(b.voxel_id.end(), ids.begin(), ids.end());
+    b.voxel_energy.insert(b.voxel_energy.end(), energies.begin(), energies.end());
+    for(auto const& semantic : semantics) b.voxel_semantic.push_back((int16_t)semantic);
+    _num_voxels += ids.size();
+
+    size_t num_clusters = cluster_offsets.size() - 1;
+    b.cluster_start.push_back(_num_clusters);
+    b.cluster_count.push_back(num_clusters);
+    for(size_t i=0; i<num_clusters; ++i) {
+      b.cluster_voxel_start.push_back(_num_cluster_voxels + cluster_offsets[i]);
+      b.cluster_voxel_count.push_back(cluster_offsets[i+1] - cluster_offsets[i]);
+    }
+    b.cluster_voxel_id.insert(b.cluster_voxel_id.end(), cluster_ids.begin(), cluster_ids.end());
+    b.cluster_voxel_energy.insert(b.cluster_voxel_energy.end(), cluster_energies.begin(), cluster_energies.end());
+    _num_cluster_voxels += cluster_ids.size();
+    _num_clusters += num_clusters;
+
+    // particles
+    auto const& particles = output.Particles();
+    b.particle_start.push_back(_num_particles);
+    b.particle_count.push_back(particles.size());
+    for(auto const& label : particles) {
+      auto const& p = label.part;
+      b.trackid.push_back(p.trackid);
+      b.parent_trackid.push_back(p.parent_trackid);
+      b.ancestor_trackid.push_back(p.ancestor_trackid);
+      b.id.push_back(p.id);
+      b.parent_id.push_back(p.parent_id);
+      b.ancestor_id.push_back(p.ancestor_id);
+      b.group_id.push_back(p.group_id);
+      b.interaction_id.push_back(p.interaction_id);
+      b.pdg.push_back(p.pdg);
+      b.parent_pdg.push_back(p.parent_pdg);
+      b.ancestor_pdg.push_back(p.ancestor_pdg);
+      b.shape.push_back(p.shape);
+      b.type.push_back(p.type);
+      b.energy_init.push_back(p.energy_init);
+      b.energy_deposit.push_back(p.energy_deposit);
+      b.px.push_back(p.px); b.py.push_back(p.py); b.pz.push_back(p.pz);
+      b.vtx_x.push_back(p.vtx.pos.x); b.vtx_y.push_back(p.vtx.pos.y);
+      b.vtx_z.push_back(p.vtx.pos.z); b.vtx_t.push_back(p.vtx.time);
+      b.first_x.push_back(p.first_step.pos.x); b.first_y.push_back(p.first_step.pos.y);
+      b.first_z.push_back(p.first_step.pos.z); b.first_t.push_back(p.first_step.time);
+      b.last_x.push_back(p.last_step.pos.x); b.last_y.push_back(p.last_step.pos.y);
+      b.last_z.push_back(p.last_step.pos.z); b.last_t.push_back(p.last_step.time);
+    }
+    _num_particles += particles.size();
+
+    ++b.num_events;
+    ++_num_events;
+    if(b.num_events >= std::max(_buffer_events, (size_t)1))
+      this->Flush();
+  }
+
+  void OutputWriter::Flush()
+  {
+    if(!_batch || !_batch->num_events) return;
+    if(!_buffer_events) {
+      this->WriteBatch(*_batch);
+      _batch.reset(new Batch_t);
+      return;
+    }
+    {
+      // keep at most two batches in flight so that a slow disk throttles the producer
+      std::unique_lock<std::mutex> lock(_queue_mtx);
+      _queue_cv.wait(lock, [this] { return _queue.size() < 2 || _writer_error; });
+      _queue.push_back(std::move(_batch));
+    }
+    _queue_cv.notify_all();
+    _batch.reset(new Batch_t);
+    this->RethrowWriterError();
+  }
+
+  void OutputWriter::WriterLoop()
+  {
+    while(true) {
+      std::unique_ptr<Batch_t> batch;
+      {
+        std::unique_lock<std::mutex> lock(_queue_mtx);
+        _queue_cv.wait(lock, [this] { return !_queue.empty() || _stop; });
+        if(_queue.empty()) return;
+        batch = std::move(_queue.front());
+      }
+      try { this->WriteBatch(*batch); }
+      catch(...) {
+        std::lock_guard<std::mutex> lock(_queue_mtx);
+        _writer_error = std::current_exception();
+        _queue.clear();
+        _queue_cv.notify_all();
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(_queue_mtx);
+        _queue.pop_front();
+      }
+      _queue_cv.notify_all();
+    }
+  }
+
+  void OutputWriter::RethrowWriterError()
+  {
+    std::exception_ptr error;
+    {
+      std::lock_guard<std::mutex> lock(_queue_mtx);
+      error = _writer_error;
+    }
+    if(error) std::rethrow_exception(error);
+  }
+
+  void OutputWriter::WriteBatch(const Batch_t& b)
+  {
+    _events.append("min_x", b.min_x); _events.append("min_y", b.min_y); _events.append("min_z", b.min_z);
+    _events.append("max_x", b.max_x); _events.append("max_y", b.max_y); _events.append("max_z", b.max_z);
+    _events.append("num_voxel_x", b.num_voxel_x);
+    _events.append("num_voxel_y", b.num_voxel_y);
+    _events.append("num_voxel_z", b.num_voxel_z);
+    _events.append("voxel_start", b.voxel_start);
+    _events.append("voxel_count", b.voxel_count);
+    _events.append("cluster_start", b.cluster_start);
+    _events.append("cluster_count", b.cluster_count);
+    _events.append("particle_start", b.particle_start);
+    _events.append("particle_count", b.particle_count);
+
+    _voxels.append("id", b.voxel_id);
+    _voxels.append("energy", b.voxel_energy);
+    _voxels.append("semantic", b.voxel_semantic);
+
+    _clusters.append("voxel_start", b.cluster_voxel_start);
+    _clusters.append("voxel_count", b.cluster_voxel_count);
+
+    _cluster_voxels.append("id", b.cluster_voxel_id);
+    _cluster_voxels.append("energy", b.cluster_voxel_energy);
+
+    _particles.append("trackid", b.trackid);
+    _particles.append("parent_trackid", b.parent_trackid);
+    _particles.append("ancestor_trackid", b.ancestor_trackid);
+    _particles.append("id", b.id);
+    _particles.append("parent_id", b.parent_id);
+    _particles.append("ancestor_id", b.ancestor_id);
+    _particles.append("group_id", b.group_id);
+    _particles.append("interaction_id", b.interaction_id);
+    _particles.append("pdg", b.pdg);
+    _particles.append("parent_pdg", b.parent_pdg);
+    _particles.append("ancestor_pdg", b.ancestor_pdg);
+    _particles.append("shape", b.shape);
+    _particles.append("type", b.type);
+    _particles.append("energy_init", b.energy_init);
+    _particles.append("energy_deposit", b.energy_deposit);
+    _particles.append("px", b.px); _particles.append("py", b.py); _particles.append("pz", b.pz);
+    _particles.append("vtx_x", b.vtx_x); _particles.append("vtx_y", b.vtx_y);
+    _particles.append("vtx_z", b.vtx_z); _particles.append("vtx_t", b.vtx_t);
+    _particles.append("first_step_x", b.first_x); _particles.append("first_step_y", b.first_y);
+    _particles.append("first_step_z", b.first_z); _particles.append("first_step_t", b.first_t);
+    _particles.append("last_step_x", b.last_x); _particles.append("last_step_y", b.last_y);
+    _particles.append("last_step_z", b.last_z); _particles.append("last_step_t", b.last_t);
+  }
+
+  void OutputWriter::Close()
+  {
+    if(!IsOpen()) return;
+
+    std::exception_ptr error;
+    try { this->Flush(); }
+    catch(...) { error = std::current_exception(); }
+    if(_writer.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(_queue_mtx);
+        _stop = true;
+      }
+      _queue_cv.notify_all();
+      _writer.join();
+      if(!error) error = _writer_error;
+    }
+    _queue.clear();
+    _batch.reset();
+
+    _events.close(); _voxels.close(); _clusters.close(); _cluster_voxels.close(); _particles.close();
+    {
+      std::lock_guard<std::mutex> lock(H5Mutex());
+      H5Fclose(_file);
+    }
+    _file = -1;
+    LOG_INFO() << "Closed after " << _num_events << " events" << std::endl;
+    if(error) std::rethrow_exception(error);
+  }
+
+}
+#endif
@@ -0,0 +1,99 @@
+/**
+ * \file OutputWriter.h
+ *
+ * \ingroup io
+ *
+ * \brief Class def header for a class supera::OutputWriter
+ *
+ */
+
+/** \addtogroup io
+    @{*/
+#ifndef __SUPERA_OUTPUTWRITER_H__
+#define __SUPERA_OUTPUTWRITER_H__
+
+#include "supera/base/Configurable.h"
+#include "supera/base/Loggable.h"
+#include "supera/data/Event.h"
+#include "supera/data/ImageMeta3D.h"
+#include "H5Table.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <thread>
+
+namespace supera {
+
+  /**
+     \class OutputWriter
+     @brief Appends EventOutput (with its ImageMeta3D) to an HDF5 file. \n
+     The file holds four tables of extendible, chunked and deflate-compressed columns: \n
+       - events   : image meta and the [start,start+count) rows of each event in the other tables \n
+       - voxels   : id, energy and semantic label of every voxel (FillTensorEnergy / FillTensorSemantic) \n
+       - clusters : voxel_start, voxel_count into cluster_voxels, one per particle plus the unassociated voxels \n
+       - particles: one row per output particle (cluster i of an event is particle i) \n
+     and cluster_voxels (id, energy) as in FillClustersEnergy. \n
+     Events are buffered and written by a background thread (write-behind) every BufferEvents events. \n
+     Configuration: ChunkSize (rows, default 65536), Compression (deflate level 0-9, default 4), \n
+     BufferEvents (default 64, 0 writes synchronously in Write()).
+  */
+  class OutputWriter : public Loggable, public Configurable {
+  public:
+    OutputWriter(const std::string& name="OutputWriter");
+    ~OutputWriter();
+
+    OutputWriter(const OutputWriter&) = delete;
+    OutputWriter& operator=(const OutputWriter&) = delete;
+
+    void Configure(const YAML::Node& cfg) override;
+
+    /// Create (truncate) the output file
+    void Open(const std::string& file_name);
+    /// Queue one event for writing
+    void Write(const ImageMeta3D& meta, const EventOutput& output);
+    /// Write the buffered events and close the file
+    void Close();
+
+    /// True between Open() and Close()
+    inline bool IsOpen() const { return _file >= 0; }
+    /// Number of events passed to Write() since Open()
+    inline size_t NumEvents() const { return _num_events; }
+
+  private:
+
+    /// Column data of a number of consecutive events
+    struct Batch_t;
+
+    void Flush();
+    void WriteBatch(const Batch_t& batch);
+    void WriterLoop();
+    void RethrowWriterError();
+
+    size_t _chunk_size;
+    int _compression;
+    size_t _buffer_events;
+
+    hid_t _file;
+    H5Table _events, _voxels, _clusters, _cluster_voxels, _particles;
+
+    size_t _num_events;          ///< events passed to Write()
+    size_t _num_voxels;          ///< rows of voxels so far (incl. buffered)
+    size_t _num_clusters;        ///< rows of clusters so far (incl. buffered)
+    size_t _num_cluster_voxels;  ///< rows of cluster_voxels so far (incl. buffered)
+    size_t _num_particles;       ///< rows of particles so far (incl. buffered)
+
+    std::unique_ptr<Batch_t> _batch;     ///< batch being filled by Write()
+
+    std::thread _writer;                 ///< write-behind thread
+    std::mutex _queue_mtx;
+    std::condition_variable _queue_cv;
+    std::deque<std::unique_ptr<Batch_t> > _queue; ///< batches waiting to be written
+    bool _stop;                          ///< tells the writer thread to finish
+    std::exception_ptr _writer_error;    ///< first error raised by the writer thread
+  };
+
+}
+
+#endif
+/** @} */ // end of doxygen group
@@ -0,0 +1,68 @@
+#ifdef BUILD_PYTHON_BINDINGS
+#include "io_pybind.h"
+
+#include "supera/pybind_mkdoc.h"
+
+#include "pybind11/stl.h"
+
+#include "BinaryEventFile.h"
+#include "BinaryEventWriter.h"
+#include "InputReader.h"
+#include "OutputWriter.h"
+
+void init_io(pybind11::module& m)
+{
+  // file I/O runs without the GIL so it overlaps with labeling in other Python threads.
+  // a reader or writer instance must still be used from one Python thread at a time.
+  using release_gil = pybind11::call_guard<pybind11::gil_scoped_release>;
+
+  pybind11::class_<supera::OutputWriter>(m, "OutputWriter", DOC(supera, OutputWriter))
+      .def(pybind11::init<const std::string&>(), DOC(supera, OutputWriter, OutputWriter),
+           pybind11::arg("name")="OutputWriter")
+      .def("ConfigureFromText", &supera::OutputWriter::ConfigureFromText)
+      .def("ConfigureFromFile", &supera::OutputWriter::ConfigureFromFile)
+      .def("Open", &supera::OutputWriter::Open, DOC(supera, OutputWriter, Open))
+      .def("Write", &supera::OutputWriter::Write, DOC(supera, OutputWriter, Write), release_gil())
+      .def("Close", &supera::OutputWriter::Close, DOC(supera, OutputWriter, Close), release_gil())
+      .def("IsOpen", &supera::OutputWriter::IsOpen, DOC(supera, OutputWriter, IsOpen))
+      .def("NumEvents", &supera::OutputWriter::NumEvents, DOC(supera, OutputWriter, NumEvents));
+
+  pybind11::class_<supera::InputReader>(m, "InputReader", DOC(supera, InputReader))
+      .def(pybind11::init<const std::string&>(), DOC(supera, InputReader, InputReader),
+           pybind11::arg("name")="InputReader")
+      .def("ConfigureFromText", &supera::InputReader::ConfigureFromText)
+      .def("ConfigureFromFile", &supera::InputReader::ConfigureFromFile)
+      .def("Open", &supera::InputReader::Open, DOC(supera, InputReader, Open))
+      .def("Close", &supera::InputReader::Close, DOC(supera, InputReader, Close))
+      .def("IsOpen", &supera::InputReader::IsOpen, DOC(supera, InputReader, IsOpen))
+      .def("NumEvents", &supera::InputReader::NumEvents, DOC(supera, InputReader, NumEvents))
+      .def("EventID", &supera::InputReader::EventID, DOC(supera, InputReader, EventID))
+      .def("Read", &supera::InputReader::Read, DOC(supera, InputReader, Read), release_gil())
+      .def("Seek", &supera::InputReader::Seek, DOC(supera, InputReader, Seek))
+      .def("NextBatch", &supera::InputReader::NextBatch, DOC(supera, InputReader, NextBatch), release_gil());
+
+
+  pybind11::class_<supera::BinaryEventWriter>(m, "BinaryEventWriter", DOC(supera, BinaryEventWriter))
+      .def(pybind11::init<>())
+      .def("Open", &supera::BinaryEventWriter::Open, DOC(supera, BinaryEventWriter, Open))
+      .def("Close", &supera::BinaryEventWriter::Close, DOC(supera, BinaryEventWriter, Close))
+      .def("IsOpen", &supera::BinaryEventWriter::IsOpen, DOC(supera, BinaryEventWriter, IsOpen))
+      .def("NumEvents", &supera::BinaryEventWriter::NumEvents, DOC(supera, BinaryEventWriter, NumEvents))
+      .def("Write", pybind11::overload_cast<const std::string&, const supera::EventInput&>(&supera::BinaryEventWriter::Write))
+      .def("Write", pybind11::overload_cast<const std::string&, const supera::ImageMeta3D&, const supera::EventOutput&>(&supera::BinaryEventWriter::Write))
+      .def("Write", pybind11::overload_cast<const std::string&, const supera::EventInput&,
+                                           const supera::ImageMeta3D&, const supera::EventOutput&>(&supera::BinaryEventWriter::Write));
+
+  pybind11::class_<supera::BinaryEventFile>(m, "BinaryEventFile", DOC(supera, BinaryEventFile))
+      .def(pybind11::init<>())
+      .def(pybind11::init<const std::string&>())
+      .def("Open", &supera::BinaryEventFile::Open, DOC(supera, BinaryEventFile, Open))
+      .def("Close", &supera::BinaryEventFile::Close, DOC(supera, BinaryEventFile, Close))
+      .def("IsOpen", &supera::BinaryEventFile::IsOpen, DOC(supera, BinaryEventFile, IsOpen))
+      .def("NumEvents", &supera::BinaryEventFile::NumEvents, DOC(supera, BinaryEventFile, NumEvents))
+      .def("Name", &supera::BinaryEventFile::Name, DOC(supera, BinaryEventFile, Name))
+      .def("Input", &supera::BinaryEventFile::Input, DOC(supera, BinaryEventFile, Input))
+      .def("Meta", &supera::BinaryEventFile::Meta, DOC(supera, BinaryEventFile, Meta))
+      .def("Output", &supera::BinaryEventFile::Output, DOC(supera, BinaryEventFile, Output));
+}
+#endif
@@ -0,0 +1,9 @@
+#ifndef SUPERA_IO_PYBIND_H
+#define SUPERA_IO_PYBIND_H
+
+#ifdef BUILD_PYTHON_BINDINGS
+  #include <pybind11/pybind11.h>
+  __attribute__ ((visibility ("default"))) void init_io(pybind11::module& m);
+#endif
+
+#endif //SUPERA_IO_PYBIND_H
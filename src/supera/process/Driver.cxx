@@ -39,7 +39,7 @@ namespace supera {
         {
             std::string name = cfg["BBoxAlgorithm"].as<std::string>();
             if(name == "BBoxInteraction") {
-                _algo_bbox = new BBoxInteraction();
+                _algo_bbox.reset(new BBoxInteraction());
                 _algo_bbox->Configure(cfg["BBoxConfig"]);
             }
             else{
@@ -61,8 +61,10 @@ namespace supera {
         {
             std::string name = cfg["LabelAlgorithm"].as<std::string>();
             if(name == "LArTPCMLReco3D") {
-                _algo_label = new LArTPCMLReco3D();
+                _algo_label.reset(new LArTPCMLReco3D());
                 _algo_label->Configure(cfg["LabelConfig"]);
+                _algo_label->SetStats(&_stats);
+                _algo_label->SetTracer(_tracer.get());
             }
             else{
                 std::string msg = name + " is not known to Supera...";
@@ -84,7 +86,7 @@ namespace supera {
         const std::map<std::string,std::string>& params)
     {
         if(name == "BBoxInteraction") {
-            _algo_bbox = new BBoxInteraction();
+            _algo_bbox.reset(new BBoxInteraction());
             PSet cfg;
             cfg.data = params;
             _algo_bbox->Configure(cfg);
@@ -103,7 +105,7 @@ namespace supera {
         const std::map<std::string,std::string>& params)
     {
         if(name == "LArTPCMLReco3D") {
-            _algo_label = new LArTPCMLReco3D();
+            _algo_label.reset(new LArTPCMLReco3D());
             PSet cfg;
             cfg.data = params;
             _algo_label->Configure(cfg);
@@ -124,9 +126,17 @@ namespace supera {
         if(!_algo_bbox) 
             throw meatloaf("BBoxAlgorithm is not configured yet!");
 
+        // a new event starts here
+        Tracer::SetCurrentEvent(_next_event++);
+
         _meta.clear();
         _label = EventOutput();
-        _meta  = _algo_bbox->Generate(data);
+        EventStats stats;
+        {
+            StageTimer timer(stats, kStageImageMeta, _tracer.get());
+            _meta  = _algo_bbox->Generate(data);
+        }
+        _stats.record(stats);
     }
 
 
@@ -137,14 +147,84 @@ namespace supera {
 
         if(!_meta.valid())
             throw meatloaf("BBoxAlgorithm must be run first");
+        TraceSpan span(_tracer.get(), "LabelAlgorithm::Generate", data.size());
         _label = _algo_label->Generate(data, _meta);
+        span.SetVoxels(_label._energies.size());
     }
 
     void Driver::Generate(const EventInput& data)
     {
         this->Reset();
+        TraceSpan span(_tracer.get(), "Driver::Generate", data.size());
         this->GenerateImageMeta(data);
         this->GenerateLabel(data);
+        span.SetVoxels(_label._energies.size());
+    }
+
+    std::vector<std::pair<ImageMeta3D,EventOutput> >
+    Driver::GenerateBatch(const std::vector<EventInput>& data, size_t n_threads) const
+    {
+        if(!_algo_bbox)
+            throw meatloaf("BBoxAlgorithm is not configured yet!");
+        if(!_algo_label)
+            throw meatloaf("LabelAlgorithm is not configured yet!");
+
+        std::vector<std::pair<ImageMeta3D,EventOutput> > result(data.size());
+
+        // reuse the threads of the previous batch; a concurrent GenerateBatch gets threads of its own
+        std::shared_ptr<WorkStealingPool> pool;
+        {
+            std::lock_guard<std::mutex> lock(_batch_pool_mtx);
+            size_t num_threads = n_threads ? n_threads : std::max(1u, std::thread::hardware_concurrency());
+            if(!_batch_pool || _batch_pool->num_threads() != num_threads)
+                _batch_pool = std::make_shared<WorkStealingPool>(num_threads);
+            pool = _batch_pool->busy() ? std::make_shared<WorkStealingPool>(num_threads) : _batch_pool;
+        }
+        LOG_INFO() << "Processing " << data.size() << " events on " << pool->num_threads() << " threads" << std::endl;
+
+        // both algorithms are const and keep their per-event state on the stack
+        size_t first_event = _next_event.fetch_add(data.size());
+        Tracer* tracer = _tracer.get();
+        pool->run(data.size(), [this,&data,&result,first_event,tracer](size_t index, size_t) {
+            Tracer::SetCurrentEvent(first_event + index);
+            TraceSpan span(tracer, "Driver::Generate", data[index].size());
+            auto& meta = result[index].first;
+            EventStats stats;
+            {
+                StageTimer timer(stats, kStageImageMeta, tracer);
+                meta = _algo_bbox->Generate(data[index]);
+            }
+            _stats.record(stats);
+            if(!meta.valid())
+                throw meatloaf("BBoxAlgorithm produced an invalid meta for event " + std::to_string(index));
+            {
+                TraceSpan label_span(tracer, "LabelAlgorithm::Generate", data[index].size());
+                result[index].second = _algo_label->Generate(data[index], meta);
+                label_span.SetVoxels(result[index].second._energies.size());
+            }
+            span.SetVoxels(result[index].second._energies.size());
+        });
+        return result;
+    }
+
+    void Driver::EnableTrace()
+    {
+        if(!_tracer) _tracer.reset(new Tracer);
+        if(_algo_label) _algo_label->SetTracer(_tracer.get());
+    }
+
+    void Driver::DisableTrace()
+    {
+        if(_algo_label) _algo_label->SetTracer(nullptr);
+        _tracer.reset();
+    }
+
+    void Driver::WriteTrace(const std::string& file_name) const
+    {
+        if(!_tracer)
+            throw meatloaf("Tracing is not enabled (call EnableTrace() first)");
+        _tracer->Write(file_name);
+        LOG_INFO() << "Wrote " << _tracer->NumSpans() << " trace spans to " << file_name << std::endl;
     }
 
 }
@@ -9,6 +9,14 @@
 #include "supera/algorithm/LabelBase.h"
 #include "supera/base/Configurable.h"
 #include "supera/base/Loggable.h"
+#include "supera/base/RunStats.h"
+#include "supera/base/Tracer.h"
+#include "supera/base/WorkStealingPool.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 
 namespace supera {
@@ -19,13 +27,19 @@ namespace supera {
 		Two algorithms need to be configured: one to define image meta data, and another to produce output image tensor information. \n
 		The former must inherit from BBoxAlgorithm (see algorithm/BBoxBase.h). The latter from LabelAlgorithm (see algorithm/LabelBase.h). \n
 		Calling a function to configure each of them will instantiate and configure the algorithm with provided parameter information (PSet). \n
+		\n
+		Concurrency: Generate(), GenerateImageMeta(), GenerateLabel() and GenerateBatch() release the Python GIL. \n
+		Distinct Driver instances may run concurrently from different threads. A single instance may run GenerateBatch() \n
+		from several threads at once (it only reads the configured algorithms), but Generate*() write Label() and Meta() \n
+		and must not overlap with each other or with Configure(), Reset(), Label(), Meta() or the *Trace() calls on the same instance. \n
+		EventInput/EventOutput objects passed in must not be modified by another thread while a call is in progress. \n
 	*/
 	class Driver : public Loggable, public Configurable {
 	public:
 
 		Driver(const std::string& name="Driver")
 		: Loggable(name)
-		, _algo_bbox(nullptr), _algo_label(nullptr) 
+		, _next_event(0)
 		{}
 
 		virtual void Configure(const YAML::Node& cfg) override;
@@ -62,6 +76,11 @@ namespace supera {
 		/// Function to execute algorithms and create output (called by Generate())
 		void GenerateLabel(const EventInput& data);
 
+		/// Generate meta and labels for many events on n_threads threads (0 = all hardware threads). \n
+		/// Results are returned in the order of the input events. Label() and Meta() are not touched.
+		std::vector<std::pair<ImageMeta3D,EventOutput> >
+		GenerateBatch(const std::vector<EventInput>& data, size_t n_threads=0) const;
+
 		///////////////////////////////
 		// Attribute accessor functions
 		///////////////////////////////
@@ -74,11 +93,38 @@ namespace supera {
 		const ImageMeta3D& Meta() const
 		{ return _meta;  }
 
+		/// Per-stage timings and counters accumulated over every event processed so far (including GenerateBatch)
+		const RunStats& Stats() const
+		{ return _stats; }
+
+		/// Zero the accumulated Stats()
+		void ResetStats()
+		{ _stats.reset(); }
+
+		/////////////////////////////////////////
+		// Tracing (Chrome trace-event JSON spans)
+		/////////////////////////////////////////
+
+		/// Record a span for Generate, the BBox algorithm and every label stage of each processed event, \n
+		/// tagged with the event index, thread and sizes. Spans accumulate until DisableTrace().
+		void EnableTrace();
+
+		/// Stop tracing and drop the recorded spans
+		void DisableTrace();
+
+		/// Write the spans recorded so far as a Chrome trace-event JSON file (not while events are being processed)
+		void WriteTrace(const std::string& file_name) const;
+
 	private:
-		BBoxAlgorithm* _algo_bbox;
-		LabelAlgorithm* _algo_label;
+		std::unique_ptr<BBoxAlgorithm> _algo_bbox;
+		std::unique_ptr<LabelAlgorithm> _algo_label;
 		ImageMeta3D _meta;
 		EventOutput _label;
+		mutable RunStats _stats; ///< recorded into by the algorithms, also from the const GenerateBatch
+		std::unique_ptr<Tracer> _tracer; ///< nullptr unless tracing is enabled
+		mutable std::atomic<size_t> _next_event; ///< index given to the next processed event (for tracing)
+		mutable std::mutex _batch_pool_mtx; ///< guards _batch_pool
+		mutable std::shared_ptr<WorkStealingPool> _batch_pool; ///< GenerateBatch threads, kept between calls
 	};
 }
 
@@ -10,15 +10,29 @@
 
 void init_process(pybind11::module& m)
 {
+  // the compute entry points run without the GIL so that Python threads (readers, writers,
+  // other Driver instances) can proceed meanwhile; see the Driver class documentation for
+  // which objects may be used concurrently.
+  using release_gil = pybind11::call_guard<pybind11::gil_scoped_release>;
+
   pybind11::class_<supera::Driver>(m, "Driver", DOC(supera, Driver))
       .def(pybind11::init(), DOC(supera, Driver, Driver))
       .def("ConfigureBBoxAlgorithm", &supera::Driver::ConfigureBBoxAlgorithm, DOC(supera, Driver, ConfigureBBoxAlgorithm))
       .def("ConfigureLabelAlgorithm", &supera::Driver::ConfigureLabelAlgorithm, DOC(supera, Driver, ConfigureLabelAlgorithm))
       .def("Reset", &supera::Driver::Reset, DOC(supera, Driver, Reset))
-      .def("GenerateImageMeta", &supera::Driver::GenerateImageMeta, DOC(supera, Driver, GenerateImageMeta))
-      .def("GenerateLabel", &supera::Driver::GenerateLabel, DOC(supera, Driver, GenerateLabel))
+      .def("Generate", &supera::Driver::Generate, DOC(supera, Driver, Generate), release_gil())
+      .def("GenerateImageMeta", &supera::Driver::GenerateImageMeta, DOC(supera, Driver, GenerateImageMeta), release_gil())
+      .def("GenerateLabel", &supera::Driver::GenerateLabel, DOC(supera, Driver, GenerateLabel), release_gil())
+      .def("GenerateBatch", &supera::Driver::GenerateBatch, DOC(supera, Driver, GenerateBatch),
+           pybind11::arg("data"), pybind11::arg("n_threads")=0, release_gil())
       .def("Label", &supera::Driver::Label, DOC(supera, Driver, Label))
-      .def("Meta", &supera::Driver::Meta, DOC(supera, Driver, Meta));
+      .def("Meta", &supera::Driver::Meta, DOC(supera, Driver, Meta))
+      .def("Stats", &supera::Driver::Stats, DOC(supera, Driver, Stats), pybind11::return_value_policy::reference_internal)
+      .def("ResetStats", &supera::Driver::ResetStats, DOC(supera, Driver, ResetStats))
+      .def("EnableTrace", &supera::Driver::EnableTrace, DOC(supera, Driver, EnableTrace))
+      .def("DisableTrace", &supera::Driver::DisableTrace, DOC(supera, Driver, DisableTrace))
+      .def("WriteTrace", &supera::Driver::WriteTrace, DOC(supera, Driver, WriteTrace),
+           pybind11::arg("file_name"), release_gil());
 
 }
 #endif
@@ -1,6 +1,7 @@
 #include "supera/base/base_pybind.h"
 #include "supera/data/data_pybind.h"
 #include "supera/process/process_pybind.h"
+#include "supera/io/io_pybind.h"
 #include "supera/test/test_pybind.h"
 //#include "supera/base/SuperaEvent.h"
 /*
@@ -11,6 +12,7 @@ PYBIND11_MODULE(pysupera, m) {
 	init_base(m);
   init_process(m);
   init_data(m);
+  init_io(m);
 
   // users won't normally interact with the testing stuff,
   // so we put it all in a submodule
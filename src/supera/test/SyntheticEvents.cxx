@@ -0,0 +1,303 @@
+#include "supera/test/SyntheticEvents.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace supera
+{
+  namespace test
+  {
+    namespace
+    {
+      const double kSpeedOfLight = 29.98;  ///< [cm/ns]
+      const size_t kNoParent = static_cast<size_t>(-1);
+
+      /// Builds one event: particles are appended to the EventInput in creation (parent-before-child) order
+      class SyntheticEventBuilder
+      {
+        public:
+          explicit SyntheticEventBuilder(const SyntheticEventConfig& cfg)
+            : _cfg(cfg), _rng(cfg.seed), _next_trackid(0)
+          {}
+
+          supera::EventInput Build()
+          {
+            std::vector<supera::Vertex> vertices;
+            for (size_t iint = 0; iint < _cfg.num_interactions; ++iint)
+            {
+              double half = _cfg.world_half_size;
+              vertices.emplace_back(Uniform(-half, half), Uniform(-half, half), Uniform(-half, half),
+                                    Uniform(0., _cfg.spill_duration));
+              Interaction(vertices.back());
+            }
+
+            // unassociated EDeps: low-energy blips around the interactions
+            for (size_t iedep = 0; iedep < _cfg.unassociated_edeps && !vertices.empty(); ++iedep)
+            {
+              auto const& vtx = vertices[Index(vertices.size())];
+              supera::EDep pt;
+              static_cast<supera::Point3D&>(pt) = vtx.pos + Direction() * Uniform(0., 30.);
+              pt.t = vtx.time + Uniform(0., 1000.);
+              pt.e = Uniform(0.01, 0.1);
+              pt.dedx = pt.e / _cfg.step_size;
+              _event.unassociated_edeps.push_back(pt);
+            }
+            return std::move(_event);
+          }
+
+        private:
+          // ---- random numbers (spelled out, so the event only depends on the mt19937 sequence) ----
+
+          double Uniform() { return _rng() * (1. / 4294967296.); }
+          double Uniform(double lo, double hi) { return lo + (hi - lo) * Uniform(); }
+          double Exponential(double mean) { return -mean * std::log(1. - Uniform()); }
+          size_t Index(size_t n) { return std::min(n - 1, static_cast<size_t>(Uniform() * n)); }
+
+          /// isotropic unit vector
+          supera::Point3D Direction()
+          {
+            double cos_theta = Uniform(-1., 1.);
+            double sin_theta = std::sqrt(1. - cos_theta * cos_theta);
+            double phi = Uniform(0., 2. * M_PI);
+            return supera::Point3D(sin_theta * std::cos(phi), sin_theta * std::sin(phi), cos_theta);
+          }
+
+          /// unit vector within roughly `spread` radians of `dir` (forward-peaked daughters of a cascade)
+          supera::Point3D Around(const supera::Point3D& dir, double spread)
+          {
+            supera::Point3D result = dir + Direction() * spread;
+            return result / std::sqrt(result * result);
+          }
+
+          // ---- particles ----
+
+          /// Append a particle created at vtx; parent/ancestor information is copied from the parent (kNoParent for a primary)
+          size_t AddParticle(supera::PdgCode_t pdg, supera::ProcessType_t type, const std::string& process,
+                             size_t parent, const supera::Vertex& vtx, const supera::Point3D& dir, double energy)
+          {
+            supera::ParticleInput input;
+            auto& part = input.part;
+            part.trackid = _next_trackid++;
+            part.pdg = pdg;
+            part.type = type;
+            part.process = process;
+            part.vtx = part.end_pt = vtx;
+            part.energy_init = energy;
+            part.px = dir.x * energy;
+            part.py = dir.y * energy;
+            part.pz = dir.z * energy;
+            if (parent == kNoParent)
+            {
+              part.parent_trackid = part.ancestor_trackid = part.trackid;
+              part.parent_pdg = part.ancestor_pdg = pdg;
+              part.parent_vtx = part.ancestor_vtx = vtx;
+              part.parent_process = part.ancestor_process = process;
+            }
+            else
+            {
+              auto const& mother = _event[parent].part;
+              part.parent_trackid = mother.trackid;
+              part.parent_pdg = mother.pdg;
+              part.parent_vtx = mother.vtx;
+              part.parent_process = mother.process;
+              part.ancestor_trackid = mother.ancestor_trackid;
+              part.ancestor_pdg = mother.ancestor_pdg;
+              part.ancestor_vtx = mother.ancestor_vtx;
+              part.ancestor_process = mother.ancestor_process;
+            }
+            _event.push_back(std::move(input));
+            return _event.size() - 1;
+          }
+
+          /// Fill a (slightly wiggly) straight trajectory of EDeps and the step/end points; returns the end point
+          supera::Vertex Trajectory(size_t index, const supera::Point3D& dir, double length, double dedx)
+          {
+            auto& input = _event[index];
+            auto& part = input.part;
+            size_t num_steps = std::max<size_t>(1, static_cast<size_t>(length / _cfg.step_size));
+            supera::Point3D pos = part.vtx.pos;
+            for (size_t step = 0; step < num_steps; ++step)
+            {
+              supera::EDep pt;
+              static_cast<supera::Point3D&>(pt) = pos;
+              pt.t = part.vtx.time + step * _cfg.step_size / kSpeedOfLight;
+              pt.dedx = dedx * Uniform(0.8, 1.2);
+              pt.e = pt.dedx * _cfg.step_size;
+              input.pcloud.push_back(pt);
+              pos += Around(dir, 0.05) * _cfg.step_size;
+            }
+            auto const& first = input.pcloud.front();
+            auto const& last = input.pcloud.back();
+            part.first_step = supera::Vertex(first.x, first.y, first.z, first.t);
+            part.last_step = supera::Vertex(last.x, last.y, last.z, last.t);
+            part.end_pt = part.last_step;
+            part.dist_travel = num_steps * _cfg.step_size;
+            part.energy_deposit = 0.;
+            for (auto const& pt : input.pcloud) part.energy_deposit += pt.e;
+            return part.end_pt;
+          }
+
+          /// A random point along the EDeps of a particle (as a vertex for a daughter)
+          supera::Vertex PointAlong(size_t index)
+          {
+            auto const& pcloud = _event[index].pcloud;
+            if (pcloud.empty()) return _event[index].part.vtx;
+            auto const& pt = pcloud[Index(pcloud.size())];
+            return supera::Vertex(pt.x, pt.y, pt.z, pt.t);
+          }
+
+          /// A handful of EDeps right at the vertex: ionization electrons, Compton/photo-electron fragments, nuclear recoils
+          void Blip(size_t index, size_t max_edeps, double dedx)
+          {
+            Trajectory(index, Direction(), _cfg.step_size * (1 + Index(max_edeps)), dedx);
+          }
+
+          // ---- topologies ----
+
+          void Interaction(const supera::Vertex& vtx)
+          {
+            static const supera::PdgCode_t track_pdgs[] = {13, 211, 2212, -13};
+            for (size_t itrack = 0; itrack < _cfg.tracks_per_interaction; ++itrack)
+              PrimaryTrack(track_pdgs[itrack % 4], vtx);
+
+            for (size_t ishower = 0; ishower < _cfg.showers_per_interaction; ++ishower)
+            {
+              auto dir = Direction();
+              double energy = Uniform(100., 1000.);
+              if (ishower % 2 == 0)
+                Electron(AddParticle(11, supera::kPrimary, "primary", kNoParent, vtx, dir, energy), dir, 0);
+              else
+                Photon(AddParticle(22, supera::kPrimary, "primary", kNoParent, vtx, dir, energy), dir, 0);
+            }
+
+            for (size_t ineutron = 0; ineutron < _cfg.neutrons_per_interaction; ++ineutron)
+            {
+              // neutrons leave no EDeps themselves; they show up as a recoil nucleus and a capture gamma far from the vertex
+              auto dir = Direction();
+              auto neutron = AddParticle(2112, supera::kPrimary, "primary", kNoParent, vtx, dir, Uniform(10., 100.));
+              auto end = vtx;
+              end.pos += dir * Exponential(50.);
+              end.time += 100.;
+              _event[neutron].part.end_pt = end;
+
+              auto recoil = AddParticle(2212, supera::kNucleus, "neutronInelastic", neutron, end, Direction(), Uniform(1., 20.));
+              Blip(recoil, 4, 10.);
+              auto capture = AddParticle(11, supera::kNeutron, "nCapture", neutron, end, Direction(), Uniform(0.1, 2.));
+              Blip(capture, 2, 2.);
+            }
+          }
+
+          void PrimaryTrack(supera::PdgCode_t pdg, const supera::Vertex& vtx)
+          {
+            auto dir = Direction();
+            bool is_proton = pdg == 2212;
+            double length = 1. + Exponential(is_proton ? _cfg.track_length / 5. : _cfg.track_length);
+            auto track = AddParticle(pdg, supera::kPrimary, "primary", kNoParent, vtx, dir, length * 2.1);
+            auto end = Trajectory(track, dir, length, is_proton ? 6. : 2.1);
+
+            const std::string ioni = std::abs(pdg) == 13 ? "muIoni" : "hIoni";
+            for (size_t idelta = 0; idelta < _cfg.deltas_per_track; ++idelta)
+            {
+              // exponential lengths: a mix of real delta rays and sub-threshold (LEScatter) ones
+              auto delta_dir = Around(dir, 1.);
+              auto delta = AddParticle(11, supera::kDelta, ioni, track, PointAlong(track), delta_dir, Uniform(0.1, 10.));
+              Trajectory(delta, delta_dir, Exponential(1.), 2.1);
+            }
+
+            for (size_t iion = 0; iion < _cfg.ionization_per_track; ++iion)
+            {
+              auto electron = AddParticle(11, supera::kIonization, ioni, track, PointAlong(track), Direction(), Uniform(0.01, 0.1));
+              Blip(electron, 2, 2.);
+            }
+
+            if (std::abs(pdg) == 13)
+            {
+              // decay at rest: Michel electron
+              auto michel_dir = Direction();
+              end.time += Exponential(2200.);
+              auto michel = AddParticle(pdg > 0 ? 11 : -11, supera::kDecay, "Decay", track, end, michel_dir, Uniform(10., 50.));
+              Trajectory(michel, michel_dir, Uniform(2., 10.), 2.1);
+            }
+            else if (pdg == 211)
+            {
+              // hadronic interaction at the end of the pion: a short secondary proton
+              auto proton_dir = Direction();
+              auto proton = AddParticle(2212, supera::kTrack, "pi+Inelastic", track, end, proton_dir, Uniform(10., 100.));
+              Trajectory(proton, proton_dir, Uniform(1., 10.), 6.);
+            }
+          }
+
+          /// Shower electron: a short track radiating shower_branching photons until the cascade reaches shower_depth
+          void Electron(size_t index, const supera::Point3D& dir, size_t generation)
+          {
+            Trajectory(index, dir, 1. + Exponential(5.), 2.1);
+            if (generation >= _cfg.shower_depth) return;
+
+            double energy = _event[index].part.energy_init / (_cfg.shower_branching + 1);
+            for (size_t ibrem = 0; ibrem < _cfg.shower_branching; ++ibrem)
+            {
+              auto photon_dir = Around(dir, 0.3);
+              auto photon = AddParticle(22, supera::kPhoton, "eBrem", index, PointAlong(index), photon_dir, energy);
+              Photon(photon, photon_dir, generation + 1);
+            }
+          }
+
+          /// Shower photon: no EDeps; converts (or Compton-scatters at the bottom of the cascade) after a radiation length or so
+          void Photon(size_t index, const supera::Point3D& dir, size_t generation)
+          {
+            auto& part = _event[index].part;
+            double energy = part.energy_init;
+            auto end = part.vtx;
+            double distance = Exponential(14.);
+            end.pos += dir * distance;
+            end.time += distance / kSpeedOfLight;
+            part.end_pt = end;
+
+            if (generation < _cfg.shower_depth)
+            {
+              for (supera::PdgCode_t pdg : {11, -11})
+              {
+                auto electron_dir = Around(dir, 0.1);
+                auto electron = AddParticle(pdg, supera::kConversion, "conv", index, end, electron_dir, energy / 2.);
+                Electron(electron, electron_dir, generation + 1);
+              }
+            }
+            else
+            {
+              auto electron_dir = Around(dir, 0.5);
+              auto electron = AddParticle(11, supera::kCompton, "compt", index, end, electron_dir, energy / 2.);
+              Electron(electron, electron_dir, generation + 1);
+            }
+
+            // low-energy fragments further down the photon path
+            for (size_t ifrag = 0; ifrag < _cfg.compton_per_photon; ++ifrag)
+            {
+              auto vtx = end;
+              double further = Exponential(10.);
+              vtx.pos += Around(dir, 0.5) * further;
+              vtx.time += further / kSpeedOfLight;
+              bool is_compton = ifrag % 2 == 0;
+              auto fragment = AddParticle(11, is_compton ? supera::kCompton : supera::kPhotoElectron,
+                                          is_compton ? "compt" : "phot", index, vtx, Direction(), Uniform(0.05, 0.5));
+              Blip(fragment, 3, 2.1);
+            }
+          }
+
+          const SyntheticEventConfig& _cfg;
+          std::mt19937 _rng;
+          supera::TrackID_t _next_trackid;
+          supera::EventInput _event;
+      };
+    }
+
+    // --------------------------------------------
+
+    supera::EventInput SyntheticEvent(const SyntheticEventConfig& cfg)
+    {
+      return SyntheticEventBuilder(cfg).Build();
+    }
+  }
+}
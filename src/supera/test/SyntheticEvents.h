@@ -0,0 +1,54 @@
+#ifndef SUPERA_SYNTHETICEVENTS_H
+#define SUPERA_SYNTHETICEVENTS_H
+
+#include <cstddef>
+
+#include "supera/data/Event.h"
+
+namespace supera
+{
+  namespace test
+  {
+    /**
+       \struct SyntheticEventConfig
+       \brief Knobs of the synthetic event generator (see \ref SyntheticEvent()).
+
+       An event is a "spill" of independent interactions, each with its own vertex (uniform in the world box)
+       and time (uniform in the spill window).  Every interaction carries:
+        - primary tracks (mu/pi/p) with delta rays, ionization electrons, Michel electrons and hadronic daughters,
+        - primary EM showers (e-/gamma) cascading through bremsstrahlung photons, pair conversions and Compton electrons,
+        - neutrons whose only energy deposits are small nuclear recoils,
+       so every merge pass of LArTPCMLReco3D has something to do.  The particle count grows linearly with
+       num_interactions and geometrically with shower_depth/shower_branching.
+    */
+    struct SyntheticEventConfig
+    {
+      unsigned int seed = 0;               ///< random seed: the same config always yields the same event
+
+      size_t num_interactions = 1;         ///< interactions per spill
+      double spill_duration   = 10000.;    ///< [ns] interaction times are spread uniformly over this window
+      double world_half_size  = 300.;      ///< [cm] vertices are uniform in a cube of this half-size around the origin
+
+      size_t tracks_per_interaction  = 2;  ///< primary tracks (mu, pi, p)
+      double track_length            = 100.; ///< [cm] mean primary track length (exponentially distributed)
+      size_t deltas_per_track        = 4;  ///< delta rays per primary track
+      size_t ionization_per_track    = 4;  ///< ionization electrons (1-2 EDeps each) per primary track
+
+      size_t showers_per_interaction = 1;  ///< primary EM showers (e- or gamma)
+      size_t shower_depth            = 4;  ///< generations of the EM cascade below the primary
+      size_t shower_branching        = 2;  ///< bremsstrahlung photons radiated per shower electron
+      size_t compton_per_photon      = 2;  ///< low-energy Compton/photoelectron fragments per shower photon
+
+      size_t neutrons_per_interaction = 1; ///< neutrons (no EDeps) with a nuclear recoil each
+
+      size_t unassociated_edeps = 100;     ///< EDeps not attached to any particle (per spill)
+
+      double step_size = 0.1;              ///< [cm] distance between consecutive EDeps along a trajectory
+    };
+
+    /// Generate a synthetic event (deterministic for a given configuration, including the seed)
+    supera::EventInput SyntheticEvent(const SyntheticEventConfig& cfg);
+  }
+}
+
+#endif //SUPERA_SYNTHETICEVENTS_H
@@ -1,6 +1,17 @@
 #include "supera/test/TestEvents.h"
 
 #include "supera/data/Particle.h"
+#include "supera/base/meatloaf.h"
+#include "supera/io/BinaryEventFile.h"
+#include "supera/io/BinaryEventWriter.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <dirent.h>
+
+#ifndef SUPERA_TEST_EVENTS_DIR
+#define SUPERA_TEST_EVENTS_DIR ""
+#endif
 
 namespace supera
 {
@@ -19,11 +30,67 @@ namespace supera
 
     std::map<std::string, TestEvent> TestEvents()
     {
-      return {
-//          {"NumuCCIncEvt", NumuCCIncEvt()}
-          {"PCMuonEvt", PCMuonEvt()}
-      };
+      std::map<std::string, TestEvent> events;
+
+      // binary fixtures, in file name order
+      std::vector<std::string> files;
+      auto dir_name = TestEventsDir();
+      if (DIR* dir = opendir(dir_name.c_str()))
+      {
+        while (dirent* entry = readdir(dir))
+        {
+          std::string name(entry->d_name);
+          if (name.size() > 4 && name.compare(name.size() - 4, 4, ".sev") == 0)
+            files.push_back(dir_name + "/" + name);
+        }
+        closedir(dir);
+      }
+      std::sort(files.begin(), files.end());
+      if (files.empty())
+        throw meatloaf("No test event fixtures (*.sev) found in '" + dir_name + "' (set SUPERA_TEST_EVENTS_DIR)");
+
+      for (auto const& file : files)
+      {
+        for (auto& name_event : LoadTestEvents(file))
+        {
+          if (!events.emplace(name_event.first, std::move(name_event.second)).second)
+            throw meatloaf("Duplicate test event name '" + name_event.first + "' in " + file);
+        }
+      }
+      return events;
     };
 
+    std::string TestEventsDir()
+    {
+      const char* dir = std::getenv("SUPERA_TEST_EVENTS_DIR");
+      return dir ? dir : SUPERA_TEST_EVENTS_DIR;
+    }
+
+    std::map<std::string, TestEvent> LoadTestEvents(const std::string& file_name)
+    {
+      std::map<std::string, TestEvent> events;
+      supera::BinaryEventFile file(file_name);
+      for (size_t entry = 0; entry < file.NumEvents(); ++entry)
+      {
+        auto view = file.View(entry);
+        if (!view.has_input() || !view.has_meta() || !view.has_output())
+          throw meatloaf("Test event '" + view.name() + "' in " + file_name + " lacks input, meta or output");
+        TestEvent& evt = events[view.name()];
+        evt.input = file.Input(entry);
+        evt.output_meta = file.Meta(entry);
+        evt.output_labels = file.Output(entry);
+      }
+      return events;
+    }
+
+    void SaveTestEvents(const std::string& file_name, const std::map<std::string, TestEvent>& events)
+    {
+      supera::BinaryEventWriter writer;
+      writer.Open(file_name);
+      for (auto const& name_event : events)
+        writer.Write(name_event.first, name_event.second.input, name_event.second.output_meta, name_event.second.output_labels);
+      writer.Close();
+    }
+
   } // namespace test
 } // namespace supera
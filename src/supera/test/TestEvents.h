@@ -5,7 +5,7 @@
 #include <string>
 
 #include "supera/data/ImageMeta3D.h"
-#include "supera/data/Particle.h"
+#include "supera/data/Event.h"
 
 namespace supera
 {
@@ -33,11 +33,20 @@ namespace supera
 
     // --------------------------------------------
 
-    TestEvent NumuCCIncEvt();
-    TestEvent PCMuonEvt();
-
-    /// Stockpile of test events with known (expected) outputs
+    /// Stockpile of test events with known (expected) outputs: every binary fixture (*.sev) found in
+    /// \ref TestEventsDir(), e.g. PCMuon.sev (throws if there is none)
     std::map<std::string, TestEvent> TestEvents();
+
+    // --------------------------------------------
+
+    /// Directory of the binary test event fixtures: $SUPERA_TEST_EVENTS_DIR if set, else src/supera/test/events
+    std::string TestEventsDir();
+
+    /// Load all events of a binary event file (see supera::BinaryEventFile), keyed by their names
+    std::map<std::string, TestEvent> LoadTestEvents(const std::string& file_name);
+
+    /// Write test events to a binary event file (e.g. to add a new fixture to \ref TestEventsDir())
+    void SaveTestEvents(const std::string& file_name, const std::map<std::string, TestEvent>& events);
   }
 }
 
@@ -1,16 +0,0 @@
-#include "supera/test/TestEvents.h"
-
-namespace supera
-{
-  namespace test
-  {
-    TestEvent NumuCCIncEvt()
-    {
-      // maybe we'll get a decent one of these at some point.
-//#include "NumuCCInc.ixx"
-      supera::test::TestEvent ret;
-
-      return ret;
-    }
-  }
-}
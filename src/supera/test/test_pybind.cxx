@@ -8,6 +8,7 @@
 #include "supera/pybind_mkdoc.h"
 
 #include "TestEvents.h"
+#include "SyntheticEvents.h"
 
 void init_tests(pybind11::module& m)
 {
@@ -17,6 +18,30 @@ void init_tests(pybind11::module& m)
       .def_readonly("output_meta", &supera::test::TestEvent::output_meta,  DOC(supera, test, TestEvent, output_meta));
 
   m.def("TestEvents", &supera::test::TestEvents, DOC(supera, test, TestEvents));
+  m.def("TestEventsDir", &supera::test::TestEventsDir, DOC(supera, test, TestEventsDir));
+  m.def("LoadTestEvents", &supera::test::LoadTestEvents, DOC(supera, test, LoadTestEvents), pybind11::arg("file_name"));
+  m.def("SaveTestEvents", &supera::test::SaveTestEvents, DOC(supera, test, SaveTestEvents),
+        pybind11::arg("file_name"), pybind11::arg("events"));
+
+  using SyntheticEventConfig = supera::test::SyntheticEventConfig;
+  pybind11::class_<SyntheticEventConfig>(m, "SyntheticEventConfig", DOC(supera, test, SyntheticEventConfig))
+      .def(pybind11::init<>())
+      .def_readwrite("seed", &SyntheticEventConfig::seed, DOC(supera, test, SyntheticEventConfig, seed))
+      .def_readwrite("num_interactions", &SyntheticEventConfig::num_interactions, DOC(supera, test, SyntheticEventConfig, num_interactions))
+      .def_readwrite("spill_duration", &SyntheticEventConfig::spill_duration, DOC(supera, test, SyntheticEventConfig, spill_duration))
+      .def_readwrite("world_half_size", &SyntheticEventConfig::world_half_size, DOC(supera, test, SyntheticEventConfig, world_half_size))
+      .def_readwrite("tracks_per_interaction", &SyntheticEventConfig::tracks_per_interaction, DOC(supera, test, SyntheticEventConfig, tracks_per_interaction))
+      .def_readwrite("track_length", &SyntheticEventConfig::track_length, DOC(supera, test, SyntheticEventConfig, track_length))
+      .def_readwrite("deltas_per_track", &SyntheticEventConfig::deltas_per_track, DOC(supera, test, SyntheticEventConfig, deltas_per_track))
+      .def_readwrite("ionization_per_track", &SyntheticEventConfig::ionization_per_track, DOC(supera, test, SyntheticEventConfig, ionization_per_track))
+      .def_readwrite("showers_per_interaction", &SyntheticEventConfig::showers_per_interaction, DOC(supera, test, SyntheticEventConfig, showers_per_interaction))
+      .def_readwrite("shower_depth", &SyntheticEventConfig::shower_depth, DOC(supera, test, SyntheticEventConfig, shower_depth))
+      .def_readwrite("shower_branching", &SyntheticEventConfig::shower_branching, DOC(supera, test, SyntheticEventConfig, shower_branching))
+      .def_readwrite("compton_per_photon", &SyntheticEventConfig::compton_per_photon, DOC(supera, test, SyntheticEventConfig, compton_per_photon))
+      .def_readwrite("neutrons_per_interaction", &SyntheticEventConfig::neutrons_per_interaction, DOC(supera, test, SyntheticEventConfig, neutrons_per_interaction))
+      .def_readwrite("unassociated_edeps", &SyntheticEventConfig::unassociated_edeps, DOC(supera, test, SyntheticEventConfig, unassociated_edeps))
+      .def_readwrite("step_size", &SyntheticEventConfig::step_size, DOC(supera, test, SyntheticEventConfig, step_size));
+  m.def("SyntheticEvent", &supera::test::SyntheticEvent, DOC(supera, test, SyntheticEvent), pybind11::arg("cfg"));
 
   using namespace pybind11::literals;
   m.def("VerifyEventLabels", &supera::test::VerifyEventLabels, DOC(supera, test, VerifyEventLabels),
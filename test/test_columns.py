@@ -0,0 +1,41 @@
+import numpy as np
+import pytest
+
+
+def make_columns(offsets, num_edeps=10):
+    particles = {
+        "traj_id": np.array([1, 2], dtype=np.int64),
+        "type":    np.array([1, 1], dtype=np.int64),
+    }
+    edeps = [np.arange(num_edeps, dtype=np.float64) + shift for shift in (0., 100., 200.)]
+    energy = np.full(num_edeps, 0.5)
+    return particles, edeps, energy, np.array(offsets, dtype=np.int64)
+
+
+def test_from_arrays():
+    import supera
+
+    particles, (x, y, z), e, offsets = make_columns([0, 4, 7])
+    event = supera.EventInput.FromArrays(particles, x, y, z, e, offsets)
+
+    assert len(event) == 2
+    assert [event[i].part.trackid for i in range(2)] == [1, 2]
+    assert len(event[0].pcloud) == 4
+    assert len(event[1].pcloud) == 3
+    assert len(event.unassociated_edeps) == 3
+    assert event[1].pcloud[0].x == x[4]
+    assert event.unassociated_edeps[-1].z == z[-1]
+
+
+@pytest.mark.parametrize("offsets", [
+    [0, 5, 3],        # decreasing
+    [0, 100000, 5],   # decreasing through an out-of-range offset
+    [0, 4, 11],       # past the EDep columns
+    [1, 4, 7],        # not starting at 0
+])
+def test_from_arrays_bad_offsets(offsets):
+    import supera
+
+    particles, (x, y, z), e, offsets = make_columns(offsets)
+    with pytest.raises(RuntimeError):
+        supera.EventInput.FromArrays(particles, x, y, z, e, offsets)
@@ -77,5 +77,49 @@ def test_events():
             raise RuntimeError("Event #%d ('%s') failed test!" % (evnum, evname))
 
 
+def test_fixture_roundtrip(tmp_path):
+    import supera
+
+    # BinaryEventWriter -> BinaryEventFile must give back exactly what was written
+    events = supera.test.TestEvents()
+    file_name = str(tmp_path / "roundtrip.sev")
+    supera.test.SaveTestEvents(file_name, events)
+    loaded = supera.test.LoadTestEvents(file_name)
+
+    assert sorted(loaded.keys()) == sorted(events.keys())
+    for evname, testev in events.items():
+        assert len(loaded[evname].input) == len(testev.input)
+        assert len(loaded[evname].input.unassociated_edeps) == len(testev.input.unassociated_edeps)
+        assert supera.test.VerifyEventMeta(loaded[evname].output_meta, testev.output_meta)
+        assert supera.test.VerifyEventLabels(loaded[evname].output_labels, testev.output_labels)
+
+
+def test_tensor_outlives_next_event():
+    import numpy as np
+    import supera
+
+    driver = supera.Driver()
+    driver.ConfigureBBoxAlgorithm("BBoxInteraction", bbox_cfg)
+    driver.ConfigureLabelAlgorithm("LArTPCMLReco3D", label_cfg)
+
+    # tensors own their buffers, so they must survive the next event overwriting the Driver's label
+    testev = next(iter(supera.test.TestEvents().values()))
+    driver.GenerateImageMeta(testev.input)
+    driver.GenerateLabel(testev.input)
+    ids, energies = driver.Label().TensorEnergy()
+    expected_ids, expected_energies = ids.copy(), energies.copy()
+    assert len(ids) > 0
+
+    cfg = supera.test.SyntheticEventConfig()
+    cfg.seed = 7
+    other = supera.test.SyntheticEvent(cfg)
+    driver.GenerateImageMeta(other)
+    driver.GenerateLabel(other)
+    driver.Label().TensorSemantic()
+
+    assert np.array_equal(ids, expected_ids)
+    assert np.array_equal(energies, expected_energies)
+
+
 if __name__ == "__main__":
     test_events()
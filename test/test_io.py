@@ -0,0 +1,149 @@
+import numpy as np
+import pytest
+
+from test_events import bbox_cfg, label_cfg
+
+
+def labeled_events():
+    import supera
+
+    driver = supera.Driver()
+    driver.ConfigureBBoxAlgorithm("BBoxInteraction", bbox_cfg)
+    driver.ConfigureLabelAlgorithm("LArTPCMLReco3D", label_cfg)
+
+    inputs = [testev.input for testev in supera.test.TestEvents().values()]
+    for seed in (1, 2, 3):
+        cfg = supera.test.SyntheticEventConfig()
+        cfg.seed = seed
+        inputs.append(supera.test.SyntheticEvent(cfg))
+
+    events = []
+    for data in inputs:
+        driver.GenerateImageMeta(data)
+        driver.GenerateLabel(data)
+        events.append((driver.Meta(), driver.Label()))
+    return events
+
+
+def test_output_roundtrip(tmp_path):
+    h5py = pytest.importorskip("h5py")
+    import supera
+
+    events = labeled_events()
+    file_name = str(tmp_path / "output.h5")
+    writer = supera.OutputWriter()
+    writer.ConfigureFromText("BufferEvents: 2")  # several write-behind batches, the last one partial
+    writer.Open(file_name)
+    for meta, label in events:
+        writer.Write(meta, label)
+    writer.Close()
+
+    with h5py.File(file_name, "r") as f:
+        ev, vox, clu, cvox, part = (f[name] for name in ("events", "voxels", "clusters", "cluster_voxels", "particles"))
+        assert len(ev["voxel_start"]) == len(events)
+
+        for entry, (meta, label) in enumerate(events):
+            assert ev["num_voxel_x"][entry] == meta.num_voxel_x()
+            assert ev["min_x"][entry] == meta.min_x()
+
+            ids, energies = label.TensorEnergy()
+            _, semantics = label.TensorSemantic()
+            start, count = ev["voxel_start"][entry], ev["voxel_count"][entry]
+            if entry:
+                assert start == ev["voxel_start"][entry-1] + ev["voxel_count"][entry-1]
+            assert count == len(ids)
+            np.testing.assert_array_equal(vox["id"][start:start+count], ids)
+            np.testing.assert_array_equal(vox["energy"][start:start+count], energies)
+            np.testing.assert_array_equal(vox["semantic"][start:start+count], semantics.astype(np.int16))
+
+            ids, energies, offsets = label.ClustersEnergy()
+            start, count = ev["cluster_start"][entry], ev["cluster_count"][entry]
+            assert count == len(offsets) - 1
+            for i in range(count):
+                vstart, vcount = clu["voxel_start"][start+i], clu["voxel_count"][start+i]
+                assert vcount == offsets[i+1] - offsets[i]
+                np.testing.assert_array_equal(cvox["id"][vstart:vstart+vcount], ids[offsets[i]:offsets[i+1]])
+                np.testing.assert_array_equal(cvox["energy"][vstart:vstart+vcount], energies[offsets[i]:offsets[i+1]])
+
+            particles = label.particles
+            start, count = ev["particle_start"][entry], ev["particle_count"][entry]
+            assert count == len(particles)
+            for i, p in enumerate(particles):
+                assert part["trackid"][start+i] == p.part.trackid
+                assert part["parent_trackid"][start+i] == p.part.parent_trackid
+                assert part["pdg"][start+i] == p.part.pdg
+                assert part["type"][start+i] == int(p.part.type)
+                assert part["shape"][start+i] == int(p.part.shape)
+                assert part["energy_deposit"][start+i] == p.part.energy_deposit
+
+
+def write_flow_file(h5py, file_name):
+    # three events; event 11 has no segments and one segment of event 12 belongs to no trajectory
+    traj = {
+        "event_id": [10, 10, 11, 12, 12, 12],
+        "traj_id":  [ 1,  2,  5,  1,  3,  4],
+        "parent_id":[-1,  1, -1, -1,  1,  3],
+        "pdg_id":   [13, 11, 22, 211, 11, 22],
+        "type":     [ 1,  2,  1,  1,  2,  2],
+        "E_start":  [500., 3., 20., 300., 2., 1.],
+    }
+    segs = {
+        "event_id": [10, 10, 10, 12, 12, 12, 12, 12],
+        "traj_id":  [ 1,  2,  1,  1,  4,  9,  3,  1],
+        "x":  np.arange(8, dtype=np.float64),
+        "y":  np.arange(8, dtype=np.float64) + 10,
+        "z":  np.arange(8, dtype=np.float64) + 20,
+        "dE": np.linspace(0.1, 0.8, 8),
+        "t":  np.zeros(8),
+    }
+    with h5py.File(file_name, "w") as f:
+        for name, table in (("mc_truth/trajectories", traj), ("mc_truth/segments", segs)):
+            group = f.create_group(name)
+            for column, values in table.items():
+                values = np.asarray(values)
+                group.create_dataset(column, data=values.astype(np.int64) if values.dtype.kind == "i" else values)
+    return traj, segs
+
+
+@pytest.mark.parametrize("read_ahead", [0, 2])
+def test_input_reader(tmp_path, read_ahead):
+    h5py = pytest.importorskip("h5py")
+    import supera
+
+    file_name = str(tmp_path / "flow.h5")
+    traj, segs = write_flow_file(h5py, file_name)
+
+    reader = supera.InputReader()
+    reader.ConfigureFromText("ReadAhead: %d" % read_ahead)
+    reader.Open(file_name)
+    assert reader.NumEvents() == 3
+    assert [reader.EventID(i) for i in range(3)] == [10, 11, 12]
+
+    events = reader.NextBatch(2) + reader.NextBatch(5)
+    assert len(events) == 3
+    assert reader.NextBatch(1) == []
+
+    for entry, event_id in enumerate((10, 11, 12)):
+        event = events[entry]
+        rows = [i for i, e in enumerate(traj["event_id"]) if e == event_id]
+        assert len(event) == len(rows)
+        traj_ids = set()
+        for part, row in zip(event, rows):
+            assert part.part.trackid == traj["traj_id"][row]
+            assert part.part.pdg == traj["pdg_id"][row]
+            assert int(part.part.type) == traj["type"][row]
+            assert part.part.energy_init == traj["E_start"][row]
+            traj_ids.add(traj["traj_id"][row])
+
+            seg_rows = [i for i, (e, t) in enumerate(zip(segs["event_id"], segs["traj_id"])) if e == event_id and t == traj["traj_id"][row]]
+            assert [pt.x for pt in part.pcloud] == [segs["x"][i] for i in seg_rows]
+            assert [pt.e for pt in part.pcloud] == [segs["dE"][i] for i in seg_rows]
+
+        unassociated = [i for i, (e, t) in enumerate(zip(segs["event_id"], segs["traj_id"])) if e == event_id and t not in traj_ids]
+        assert [pt.z for pt in event.unassociated_edeps] == [segs["z"][i] for i in unassociated]
+
+        # random access gives the same event as sequential reading
+        direct = reader.Read(entry)
+        assert [len(p.pcloud) for p in direct] == [len(p.pcloud) for p in event]
+        assert len(direct.unassociated_edeps) == len(event.unassociated_edeps)
+    reader.Close()